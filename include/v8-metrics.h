@@ -160,6 +160,37 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+/**
+ * The optimizing tier a JSFunctionOptimized or JSFunctionDeoptimized event
+ * refers to.
+ */
+enum class OptimizedTier : uint8_t { kMaglev, kTurbofan };
+
+struct JSFunctionOptimized {
+  // Identifies the function by its script id and source start position.
+  int script_id = -1;
+  int function_start_position = -1;
+  OptimizedTier tier = OptimizedTier::kTurbofan;
+  bool osr = false;
+  bool success = false;
+  size_t code_size_in_bytes = 0;
+  // Sum of the prepare, execute and finalize phases of the compilation job.
+  int64_t wall_clock_duration_in_us = -1;
+};
+
+struct JSFunctionDeoptimized {
+  // Identifies the function by its script id and source start position.
+  int script_id = -1;
+  int function_start_position = -1;
+  OptimizedTier tier = OptimizedTier::kTurbofan;
+  bool osr = false;
+  bool lazy = false;
+  // Statically allocated description of the deoptimization reason.
+  const char* reason = nullptr;
+  // Bytecode offset at which execution resumes in the unoptimized frame.
+  int bytecode_offset = -1;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -212,6 +243,8 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(JSFunctionOptimized)
+  ADD_MAIN_THREAD_EVENT(JSFunctionDeoptimized)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
@@ -48,6 +48,7 @@
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/js-function-inl.h"
@@ -307,6 +308,46 @@ class CompilerTracer : public AllStatic {
   }
 };
 
+// Reports the outcome of an optimizing compile job to the embedder's metrics
+// recorder, if one is installed.
+void RecordJSFunctionOptimizedEvent(Isolate* isolate,
+                                    DirectHandle<JSFunction> function,
+                                    v8::metrics::OptimizedTier tier, bool osr,
+                                    bool success, size_t code_size_in_bytes,
+                                    double ms_prepare, double ms_execute,
+                                    double ms_finalize) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  v8::metrics::JSFunctionOptimized event;
+  if (IsScript(shared->script())) {
+    event.script_id = Cast<Script>(shared->script())->id();
+  }
+  event.function_start_position = shared->StartPosition();
+  event.tier = tier;
+  event.osr = osr;
+  event.success = success;
+  event.code_size_in_bytes = code_size_in_bytes;
+  event.wall_clock_duration_in_us = static_cast<int64_t>(
+      (ms_prepare + ms_execute + ms_finalize) *
+      base::Time::kMicrosecondsPerMillisecond);
+  DirectHandle<NativeContext> native_context(function->native_context(),
+                                             isolate);
+  recorder->DelayMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(native_context));
+}
+
+void RecordTurbofanJobEvent(Isolate* isolate, TurbofanCompilationJob* job,
+                            bool success) {
+  OptimizedCompilationInfo* compilation_info = job->compilation_info();
+  RecordJSFunctionOptimizedEvent(
+      isolate, compilation_info->closure(),
+      v8::metrics::OptimizedTier::kTurbofan, compilation_info->is_osr(),
+      success, success ? compilation_info->code()->instruction_size() : 0,
+      job->prepare_in_ms(), job->execute_in_ms(), job->finalize_in_ms());
+}
+
 }  // namespace
 
 // static
@@ -1075,6 +1116,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    RecordTurbofanJobEvent(isolate, job, false);
     return false;
   }
 
@@ -1083,6 +1125,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    RecordTurbofanJobEvent(isolate, job, false);
     return false;
   }
 
@@ -1090,6 +1133,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
     CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                     job->prepare_in_ms(), job->execute_in_ms(),
                                     job->finalize_in_ms());
+    RecordTurbofanJobEvent(isolate, job, false);
     return false;
   }
 
@@ -1101,6 +1145,7 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
                              *compilation_info->code(),
                              compilation_info->function_context_specializing());
   job->RecordFunctionCompilation(LogEventListener::CodeTag::kFunction, isolate);
+  RecordTurbofanJobEvent(isolate, job, true);
   return true;
 }
 
@@ -1282,6 +1327,10 @@ MaybeHandle<Code> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
         job->ExecuteJob(isolate->counters()->runtime_call_stats(),
                         isolate->main_thread_local_isolate());
     if (status == CompilationJob::FAILED) {
+      RecordJSFunctionOptimizedEvent(
+          isolate, function, v8::metrics::OptimizedTier::kMaglev,
+          job->is_osr(), false, 0, job->prepare_in_ms(), job->execute_in_ms(),
+          job->finalize_in_ms());
       return {};
     }
     CHECK_EQ(status, CompilationJob::SUCCEEDED);
@@ -4329,6 +4378,7 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
             compilation_info->osr_offset(), *compilation_info->code(),
             compilation_info->function_context_specializing());
         CompilerTracer::TraceCompletedJob(isolate, compilation_info);
+        RecordTurbofanJobEvent(isolate, job, true);
         if (IsOSR(osr_offset)) {
           CompilerTracer::TraceOptimizeOSRFinished(isolate, function,
                                                    osr_offset);
@@ -4350,6 +4400,7 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
                                   job->prepare_in_ms(), job->execute_in_ms(),
                                   job->finalize_in_ms());
   if (V8_LIKELY(use_result)) {
+    RecordTurbofanJobEvent(isolate, job, false);
     ResetTieringState(isolate, *function, osr_offset);
     if (!IsOSR(osr_offset)) {
       function->UpdateCode(shared->GetCode(isolate));
@@ -4410,6 +4461,15 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
     CompilerTracer::TraceFinishMaglevCompile(
         isolate, function, job->is_osr(), job->prepare_in_ms(),
         job->execute_in_ms(), job->finalize_in_ms());
+    RecordJSFunctionOptimizedEvent(
+        isolate, function, v8::metrics::OptimizedTier::kMaglev, job->is_osr(),
+        true, code->instruction_size(), job->prepare_in_ms(),
+        job->execute_in_ms(), job->finalize_in_ms());
+  } else {
+    RecordJSFunctionOptimizedEvent(
+        isolate, function, v8::metrics::OptimizedTier::kMaglev, job->is_osr(),
+        false, 0, job->prepare_in_ms(), job->execute_in_ms(),
+        job->finalize_in_ms());
   }
 #endif
 }
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <limits>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -84,7 +86,24 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
     LocalIsolate* local_isolate) {
-  return input_queue_.Dequeue();
+  base::TimeDelta wait_time;
+  TurbofanCompilationJob* job = input_queue_.Dequeue(&wait_time);
+  if (job) {
+    isolate_->counters()->turbofan_optimize_queue_wait()->AddTimedSample(
+        wait_time);
+  }
+  return job;
+}
+
+int64_t OptimizingCompileDispatcher::ComputePriorityKey(
+    TurbofanCompilationJob* job) {
+  // Every job queued after this one may overtake it by at most this many
+  // bytes of bytecode.
+  static constexpr int64_t kAgingBytecodeBytesPerJob = 256;
+  int64_t sequence = enqueued_job_count_++;
+  Tagged<SharedFunctionInfo> shared = *job->compilation_info()->shared_info();
+  int64_t cost = shared->GetBytecodeArray(isolate_)->length();
+  return cost + sequence * kAgingBytecodeBytesPerJob;
 }
 
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
@@ -124,7 +143,7 @@ void OptimizingCompileDispatcher::FlushOutputQueue() {
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
+    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)].job);
     DCHECK_NOT_NULL(job);
     shift_ = QueueIndex(1);
     length_--;
@@ -215,7 +234,7 @@ bool OptimizingCompileDispatcher::HasJobs() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(input_queue_.IsAvailable());
-  input_queue_.Enqueue(job);
+  input_queue_.Enqueue(job, ComputePriorityKey(job));
   if (job_handle_->UpdatePriorityEnabled()) {
     job_handle_->UpdatePriority(isolate_->EfficiencyModeEnabledForTiering()
                                     ? kEfficiencyTaskPriority
@@ -229,8 +248,10 @@ void OptimizingCompileDispatcherQueue::Prioritize(
   base::MutexGuard access(&mutex_);
   if (length_ > 1) {
     for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
+      if (*queue_[QueueIndex(i)].job->compilation_info()->shared_info() ==
           function) {
+        queue_[QueueIndex(i)].priority_key =
+            std::numeric_limits<int64_t>::min();
         std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
         return;
       }
@@ -245,7 +266,8 @@ void OptimizingCompileDispatcher::Prioritize(
 
 OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
     : isolate_(isolate),
-      input_queue_(v8_flags.concurrent_recompilation_queue_length),
+      input_queue_(v8_flags.concurrent_recompilation_queue_length,
+                   v8_flags.concurrent_recompilation_prioritize_by_cost),
       recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
   if (v8_flags.concurrent_recompilation) {
     job_handle_ = V8::GetCurrentPlatform()->PostJob(
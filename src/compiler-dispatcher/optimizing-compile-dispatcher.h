@@ -10,6 +10,7 @@
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/parked-scope.h"
@@ -24,6 +25,10 @@ class RuntimeCallStats;
 class SharedFunctionInfo;
 
 // Circular queue of incoming recompilation tasks (including OSR).
+//
+// Jobs are dequeued in FIFO order, unless the queue prioritizes by cost, in
+// which case the job with the smallest priority key is dequeued first. Keys
+// are computed by the dispatcher when enqueuing.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
   inline bool IsAvailable() {
@@ -36,27 +41,43 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return length_;
   }
 
-  explicit OptimizingCompileDispatcherQueue(int capacity)
-      : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+  explicit OptimizingCompileDispatcherQueue(int capacity,
+                                            bool prioritize_by_cost = false)
+      : capacity_(capacity),
+        length_(0),
+        shift_(0),
+        prioritize_by_cost_(prioritize_by_cost) {
+    queue_ = NewArray<Entry>(capacity_);
   }
 
   ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
 
-  TurbofanCompilationJob* Dequeue() {
+  // Returns the next job, and how long it has been waiting in the queue.
+  TurbofanCompilationJob* Dequeue(base::TimeDelta* wait_time = nullptr) {
     base::MutexGuard access(&mutex_);
     if (length_ == 0) return nullptr;
-    TurbofanCompilationJob* job = queue_[QueueIndex(0)];
-    DCHECK_NOT_NULL(job);
+    if (prioritize_by_cost_) {
+      int best = 0;
+      for (int i = 1; i < length_; ++i) {
+        if (queue_[QueueIndex(i)].priority_key <
+            queue_[QueueIndex(best)].priority_key) {
+          best = i;
+        }
+      }
+      std::swap(queue_[QueueIndex(best)], queue_[QueueIndex(0)]);
+    }
+    Entry entry = queue_[QueueIndex(0)];
+    DCHECK_NOT_NULL(entry.job);
     shift_ = QueueIndex(1);
     length_--;
-    return job;
+    if (wait_time) *wait_time = base::TimeTicks::Now() - entry.enqueue_time;
+    return entry.job;
   }
 
-  void Enqueue(TurbofanCompilationJob* job) {
+  void Enqueue(TurbofanCompilationJob* job, int64_t priority_key = 0) {
     base::MutexGuard access(&mutex_);
     DCHECK_LT(length_, capacity_);
-    queue_[QueueIndex(length_)] = job;
+    queue_[QueueIndex(length_)] = {job, priority_key, base::TimeTicks::Now()};
     length_++;
   }
 
@@ -65,6 +86,12 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
  private:
+  struct Entry {
+    TurbofanCompilationJob* job;
+    int64_t priority_key;
+    base::TimeTicks enqueue_time;
+  };
+
   inline int QueueIndex(int i) {
     int result = (i + shift_) % capacity_;
     DCHECK_LE(0, result);
@@ -72,10 +99,11 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return result;
   }
 
-  TurbofanCompilationJob** queue_;
+  Entry* queue_;
   int capacity_;
   int length_;
   int shift_;
+  const bool prioritize_by_cost_;
   base::Mutex mutex_;
 };
 
@@ -123,10 +151,15 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void FlushOutputQueue();
   void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
   TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  // Estimated compile cost of {job}, aged by its position in the enqueue
+  // order so that expensive jobs are not starved.
+  int64_t ComputePriorityKey(TurbofanCompilationJob* job);
 
   Isolate* isolate_;
 
   OptimizingCompileDispatcherQueue input_queue_;
+  // Number of jobs queued so far, used to age priority keys.
+  int64_t enqueued_job_count_ = 0;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
   std::queue<TurbofanCompilationJob*> output_queue_;
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+#include <optional>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
@@ -442,7 +446,59 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Intel Golden Cove (and later) and AMD Zen 3 (and later) cores have much
+// faster integer and floating point dividers than the cores the generic
+// latencies below were measured on. AVX-VNNI is used as a marker for the
+// former, since it first shipped with Golden Cove.
+bool HasFastDividers() {
+  static const bool fast_dividers = [] {
+    base::CPU cpu;
+    if (strcmp(cpu.vendor(), "GenuineIntel") == 0) return cpu.has_avx_vnni();
+    if (strcmp(cpu.vendor(), "AuthenticAMD") == 0) {
+      return cpu.family() == 0xF && cpu.ext_family() >= 0xA;
+    }
+    return false;
+  }();
+  return fast_dividers;
+}
+
+std::optional<int> GetFastDividerLatency(ArchOpcode opcode) {
+  switch (opcode) {
+    case kX64Idiv:
+    case kX64Udiv:
+      return 15;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 12;
+    // These cores all support AVX, so the instruction selector emits the AVX
+    // forms of the floating point operations there.
+    case kAVXFloat32Div:
+    case kSSEFloat32Div:
+      return 11;
+    case kAVXFloat64Div:
+    case kSSEFloat64Div:
+      return 13;
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+      return 4;
+    default:
+      return {};
+  }
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  if (HasFastDividers()) {
+    if (std::optional<int> latency =
+            GetFastDividerLatency(instr->arch_opcode())) {
+      return *latency;
+    }
+  }
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
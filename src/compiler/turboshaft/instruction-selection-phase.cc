@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/instruction-selection-phase.h"
 
+#include <algorithm>
 #include <optional>
 
 #include "src/builtins/profile-data-reader.h"
@@ -59,7 +60,7 @@ ZoneVector<uint32_t> TurboshaftSpecialRPONumberer::ComputeSpecialRPO() {
   size_t num_loops = 0;
 
   auto Push = [&](const Block* block) {
-    auto succs = SuccessorBlocks(*block, *graph_);
+    auto succs = SuccessorBlocksInLayoutOrder(block);
     stack.emplace_back(block, 0, std::move(succs));
     set_rpo_number(block, kBlockOnStack);
   };
@@ -199,6 +200,24 @@ ZoneVector<uint32_t> TurboshaftSpecialRPONumberer::ComputeSpecialRPO() {
   return ComputeBlockPermutation(entry);
 }
 
+// Successors are visited in the returned order, and the successor that is
+// visited last ends up immediately after {block} in the final order. With
+// --turbo-profile-guided-block-layout, successors that are unlikely according
+// to the (possibly profile-derived) branch hints are therefore moved to the
+// front, so that the likely successor becomes the fall-through block.
+base::SmallVector<Block*, 4>
+TurboshaftSpecialRPONumberer::SuccessorBlocksInLayoutOrder(
+    const Block* block) const {
+  base::SmallVector<Block*, 4> succs = SuccessorBlocks(*block, *graph_);
+  if (!v8_flags.turbo_profile_guided_block_layout || succs.size() < 2) {
+    return succs;
+  }
+  std::stable_partition(succs.begin(), succs.end(), [&](const Block* succ) {
+    return IsUnlikelySuccessor(block, succ, *graph_);
+  });
+  return succs;
+}
+
 // Computes loop membership from the backedges of the control flow graph.
 void TurboshaftSpecialRPONumberer::ComputeLoopInfo(
     size_t num_loops, ZoneVector<Backedge>& backedges) {
@@ -73,6 +73,8 @@ class V8_EXPORT_PRIVATE TurboshaftSpecialRPONumberer {
   ZoneVector<uint32_t> ComputeSpecialRPO();
 
  private:
+  base::SmallVector<Block*, 4> SuccessorBlocksInLayoutOrder(
+      const Block* block) const;
   void ComputeLoopInfo(size_t num_loops, ZoneVector<Backedge>& backedges);
   ZoneVector<uint32_t> ComputeBlockPermutation(const Block* entry);
 
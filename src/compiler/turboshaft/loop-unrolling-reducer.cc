@@ -20,6 +20,11 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
     IterationCount iter_count = GetLoopIterationCount(info);
     loop_iteration_count_.insert({start, iter_count});
 
+    if (!is_wasm_ && v8_flags.turboshaft_typed_array_loop_unrolling &&
+        IsTypedArrayKernelLoop(info)) {
+      typed_array_kernel_loops_.insert(start);
+    }
+
     if (ShouldFullyUnrollLoop(start) || ShouldPartiallyUnrollLoop(start)) {
       can_unroll_at_least_one_loop_ = true;
     }
@@ -30,6 +35,29 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   }
 }
 
+// Returns true for small inner loops that load from or store to ArrayBuffer
+// backing stores (which, in the JS pipeline, are the only non-load-eliminable
+// memory accesses) and that don't contain any call.
+bool LoopUnrollingAnalyzer::IsTypedArrayKernelLoop(
+    const LoopFinder::LoopInfo& info) {
+  if (info.has_inner_loops ||
+      info.op_count >= kTypedArrayKernelMaxLoopSizeForPartialUnrolling) {
+    return false;
+  }
+  bool accesses_typed_array = false;
+  for (const Block* block : loop_finder_.GetLoopBody(info.start)) {
+    for (const Operation& op : input_graph_->operations(*block)) {
+      if (op.Is<CallOp>()) return false;
+      if (const LoadOp* load = op.TryCast<LoadOp>()) {
+        if (!load->kind.load_eliminable) accesses_typed_array = true;
+      } else if (const StoreOp* store = op.TryCast<StoreOp>()) {
+        if (!store->kind.load_eliminable) accesses_typed_array = true;
+      }
+    }
+  }
+  return accesses_typed_array;
+}
+
 IterationCount LoopUnrollingAnalyzer::GetLoopIterationCount(
     const LoopFinder::LoopInfo& info) const {
   const Block* start = info.start;
@@ -173,6 +173,7 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
         loop_iteration_count_(phase_zone),
         canonical_loop_matcher_(matcher_),
         is_wasm_(is_wasm),
+        typed_array_kernel_loops_(phase_zone),
         stack_checks_to_remove_(input_graph->stack_checks_to_remove()) {
     DetectUnrollableLoops();
   }
@@ -192,8 +193,10 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   bool ShouldPartiallyUnrollLoop(const Block* loop_header) const {
     DCHECK(loop_header->IsLoop());
     auto info = loop_finder_.GetLoopInfo(loop_header);
-    return !info.has_inner_loops &&
-           info.op_count < kMaxLoopSizeForPartialUnrolling;
+    size_t max_size = typed_array_kernel_loops_.contains(loop_header)
+                          ? kTypedArrayKernelMaxLoopSizeForPartialUnrolling
+                          : kMaxLoopSizeForPartialUnrolling;
+    return !info.has_inner_loops && info.op_count < max_size;
   }
 
   bool ShouldRemoveLoop(const Block* loop_header) const {
@@ -225,12 +228,18 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   static constexpr size_t kMaxLoopSizeForFullUnrolling = 150;
   static constexpr size_t kJSMaxLoopSizeForPartialUnrolling = 50;
   static constexpr size_t kWasmMaxLoopSizeForPartialUnrolling = 80;
+  // JS loops that only access TypedArray/DataView backing stores and don't
+  // call anything (sums, dot products, element-wise maps, ...) profit from
+  // unrolling about as much as Wasm loops do.
+  static constexpr size_t kTypedArrayKernelMaxLoopSizeForPartialUnrolling =
+      kWasmMaxLoopSizeForPartialUnrolling;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kPartialUnrollingCount = 4;
   static constexpr size_t kMaxIterForStackCheckRemoval = 5000;
 
  private:
   void DetectUnrollableLoops();
+  bool IsTypedArrayKernelLoop(const LoopFinder::LoopInfo& info);
   IterationCount GetLoopIterationCount(const LoopFinder::LoopInfo& info) const;
 
   Graph* input_graph_;
@@ -245,6 +254,9 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   const size_t kMaxLoopSizeForPartialUnrolling =
       is_wasm_ ? kWasmMaxLoopSizeForPartialUnrolling
                : kJSMaxLoopSizeForPartialUnrolling;
+  // Loop headers of JS loops that have been recognized as TypedArray kernels,
+  // see IsTypedArrayKernelLoop.
+  ZoneAbslFlatHashSet<const Block*> typed_array_kernel_loops_;
   bool can_unroll_at_least_one_loop_ = false;
 
   ZoneAbslFlatHashSet<uint32_t>& stack_checks_to_remove_;
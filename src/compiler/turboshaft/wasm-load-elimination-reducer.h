@@ -450,6 +450,8 @@ class WasmLoadEliminationAnalyzer {
   void ProcessStructSet(OpIndex op_idx, const StructSetOp& op);
   void ProcessArrayLength(OpIndex op_idx, const ArrayLengthOp& op);
   void ProcessWasmAllocateArray(OpIndex op_idx, const WasmAllocateArrayOp& op);
+  void ProcessWasmAllocateStruct(OpIndex op_idx,
+                                 const WasmAllocateStructOp& op);
   void ProcessStringAsWtf16(OpIndex op_idx, const StringAsWtf16Op& op);
   void ProcessStringPrepareForGetCodeUnit(
       OpIndex op_idx, const StringPrepareForGetCodeUnitOp& op);
@@ -586,6 +588,9 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
       case Opcode::kWasmAllocateArray:
         ProcessWasmAllocateArray(op_idx, op.Cast<WasmAllocateArrayOp>());
         break;
+      case Opcode::kWasmAllocateStruct:
+        ProcessWasmAllocateStruct(op_idx, op.Cast<WasmAllocateStructOp>());
+        break;
       case Opcode::kStringAsWtf16:
         ProcessStringAsWtf16(op_idx, op.Cast<StringAsWtf16Op>());
         break;
@@ -602,6 +607,12 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
         ProcessAssertNotNull(op_idx, op.Cast<AssertNotNullOp>());
         break;
       case Opcode::kArraySet:
+        // The stored value escapes into the array.
+        InvalidateIfAlias(op.Cast<ArraySetOp>().value());
+        break;
+      case Opcode::kGlobalSet:
+        // The stored value escapes into the global.
+        InvalidateIfAlias(op.Cast<GlobalSetOp>().value());
         break;
       case Opcode::kAllocate:
         // Create new non-alias.
@@ -615,14 +626,18 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
         // Invalidate aliases.
         ProcessPhi(op_idx, op.Cast<PhiOp>());
         break;
-      case Opcode::kLoad:
-        // Atomic loads have the "can_write" bit set, because they make
-        // writes on other threads visible. At any rate, we have to
-        // explicitly skip them here.
       case Opcode::kStore:
         // We rely on having no raw "Store" operations operating on Wasm
         // objects at this point in the pipeline.
         // TODO(jkummerow): Is there any way to DCHECK that?
+        // The stored value can still escape, e.g. into the values array of an
+        // exception created by `throw`.
+        InvalidateIfAlias(op.Cast<StoreOp>().value());
+        break;
+      case Opcode::kLoad:
+        // Atomic loads have the "can_write" bit set, because they make
+        // writes on other threads visible. At any rate, we have to
+        // explicitly skip them here.
       case Opcode::kAssumeMap:
       case Opcode::kCatchBlockBegin:
       case Opcode::kRetain:
@@ -634,7 +649,6 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
       case Opcode::kJSStackCheck:
       case Opcode::kWasmStackCheck:
       case Opcode::kSimd128LaneMemory:
-      case Opcode::kGlobalSet:
       case Opcode::kParameter:
         // We explicitly break for those operations that have can_write effects
         // but don't actually write, or cannot interfere with load elimination.
@@ -650,6 +664,8 @@ void WasmLoadEliminationAnalyzer::ProcessBlock(const Block& block,
       case Opcode::kDeoptimizeIf:
       case Opcode::kComparison:
       case Opcode::kTrapIf:
+      case Opcode::kIsNull:
+      case Opcode::kWasmTypeCheck:
         // We explicitly break for these opcodes so that we don't call
         // InvalidateAllNonAliasingInputs on their inputs, since they don't
         // really create aliases. (and also, they don't write so it's
@@ -779,6 +795,15 @@ void WasmLoadEliminationAnalyzer::ProcessWasmAllocateArray(
   memory_.InsertLoadLike(op_idx, offset, alloc.length());
 }
 
+void WasmLoadEliminationAnalyzer::ProcessWasmAllocateStruct(
+    OpIndex op_idx, const WasmAllocateStructOp&) {
+  // A fresh struct cannot be modified by calls it is not passed to, so fields
+  // initialized by {struct.new} can be forwarded across such calls. If the
+  // struct does not escape otherwise, the allocation and its initializing
+  // stores are removed by the {LateEscapeAnalysisReducer} after lowering.
+  non_aliasing_objects_.Set(op_idx, true);
+}
+
 void WasmLoadEliminationAnalyzer::ProcessStringAsWtf16(
     OpIndex op_idx, const StringAsWtf16Op& op) {
   static constexpr int offset = wle::kStringAsWtf16Index;
@@ -821,6 +846,8 @@ void WasmLoadEliminationAnalyzer::ProcessAnyConvertExtern(
 
 void WasmLoadEliminationAnalyzer::ProcessAssertNotNull(
     OpIndex op_idx, const AssertNotNullOp& assert) {
+  // The result is another name for the same object.
+  InvalidateIfAlias(assert.object());
   static constexpr int offset = wle::kAssertNotNullIndex;
   OpIndex existing = memory_.FindLoadLike(assert.object(), offset);
   if (existing.valid()) {
@@ -911,7 +938,6 @@ void WasmLoadEliminationAnalyzer::DcheckWordBinop(OpIndex op_idx,
 
 void WasmLoadEliminationAnalyzer::ProcessAllocate(OpIndex op_idx,
                                                   const AllocateOp&) {
-  // In particular, this handles {struct.new}.
   non_aliasing_objects_.Set(op_idx, true);
 }
 
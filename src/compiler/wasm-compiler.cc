@@ -3661,9 +3661,20 @@ std::pair<Node*, BoundsCheckResult> WasmGraphBuilder::BoundsCheckMem(
   if (bounds_checks == wasm::kTrapHandler &&
       enforce_check == EnforceBoundsCheck::kCanOmitBoundsCheck) {
     if (memory->is_memory64) {
-      Node* cond = gasm_->Uint64LessThan(
-          converted_index, Int64Constant(memory->GetMemory64GuardsSize()));
-      TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+      // Only indexes beyond the guard regions need an explicit check. Skip it
+      // if the index is known to be small enough, e.g. because it was
+      // zero-extended from an i32.
+      const uint64_t guards_size = memory->GetMemory64GuardsSize();
+      bool index_within_guards =
+          constant_index.HasResolvedValue()
+              ? constant_index.ResolvedValue() < guards_size
+              : converted_index->opcode() == IrOpcode::kChangeUint32ToUint64 &&
+                    guards_size > kMaxUInt32;
+      if (!index_within_guards) {
+        Node* cond = gasm_->Uint64LessThan(converted_index,
+                                           Int64Constant(guards_size));
+        TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+      }
     }
     return {converted_index, BoundsCheckResult::kTrapHandler};
   }
@@ -8226,7 +8237,8 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     if (ContainsInt64(sig_)) LowerInt64(wasm::kCalledFromWasm);
   }
 
-  void BuildJSFastApiCallWrapper(Handle<JSReceiver> callable) {
+  void BuildJSFastApiCallWrapper(Handle<JSReceiver> callable,
+                                 int c_function_index) {
     // Here 'callable_node' must be equal to 'callable' but we cannot pass a
     // HeapConstant(callable) because WasmCode::Validate() fails with
     // Unexpected mode: FULL_EMBEDDED_OBJECT.
@@ -8274,9 +8286,10 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
 
     Tagged<SharedFunctionInfo> shared = target->shared();
     Tagged<FunctionTemplateInfo> api_func_data = shared->api_func_data();
-    const Address c_address = api_func_data->GetCFunction(isolate, 0);
+    const Address c_address =
+        api_func_data->GetCFunction(isolate, c_function_index);
     const v8::CFunctionInfo* c_signature =
-        api_func_data->GetCSignature(target->GetIsolate(), 0);
+        api_func_data->GetCSignature(target->GetIsolate(), c_function_index);
 
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
     Address c_functions[] = {c_address};
@@ -8305,7 +8318,7 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
             int param_index,
             fast_api_call::OverloadsResolutionResult& overloads,
             GraphAssemblerLabel<0>*) {
-          // Wasm does not currently support overloads
+          // The overload is selected statically from the import signature.
           CHECK(!overloads.is_valid());
 
           if (param_index == 0) {
@@ -8756,7 +8769,7 @@ bool IsFastCallSupportedSignature(const v8::CFunctionInfo* sig) {
 
 wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
     wasm::NativeModule* native_module, const wasm::FunctionSig* sig,
-    Handle<JSReceiver> callable) {
+    Handle<JSReceiver> callable, int c_function_index) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm.detailed"),
                "wasm.CompileWasmJSFastCallWrapper");
 
@@ -8774,7 +8787,7 @@ wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
                     1 /* offset for first parameter index being -1 */ +
                     1 /* Wasm instance */ + 1 /* kExtraCallableParam */;
   builder.Start(param_count);
-  builder.BuildJSFastApiCallWrapper(callable);
+  builder.BuildJSFastApiCallWrapper(callable, c_function_index);
 
   // Run the compiler pipeline to generate machine code.
   CallDescriptor* call_descriptor =
@@ -81,9 +81,11 @@ wasm::WasmCompilationResult CompileWasmCapiCallWrapper(
     wasm::NativeModule*, const wasm::FunctionSig*);
 
 bool IsFastCallSupportedSignature(const v8::CFunctionInfo*);
-// Compiles a wrapper to call a Fast API function from Wasm.
+// Compiles a wrapper to call a Fast API function from Wasm. {c_function_index}
+// selects the C function overload that matches {sig}.
 wasm::WasmCompilationResult CompileWasmJSFastCallWrapper(
-    wasm::NativeModule*, const wasm::FunctionSig*, Handle<JSReceiver> callable);
+    wasm::NativeModule*, const wasm::FunctionSig*, Handle<JSReceiver> callable,
+    int c_function_index);
 
 // Returns an TurbofanCompilationJob or TurboshaftCompilationJob object
 // (depending on the --turboshaft-wasm-wrappers flag) for a JS to Wasm wrapper.
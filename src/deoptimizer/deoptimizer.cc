@@ -1373,6 +1373,82 @@ bool DeoptimizedMaglevvedCodeEarly(Isolate* isolate,
              v8_flags.invocation_count_for_maglev_with_delay;
 }
 
+// Returns the index of the feedback slot operand of {bytecode}, for the
+// bytecodes whose speculation can be disabled by generalizing their feedback.
+std::optional<int> PinnableFeedbackSlotOperandIndex(
+    interpreter::Bytecode bytecode) {
+  switch (bytecode) {
+    case interpreter::Bytecode::kInc:
+    case interpreter::Bytecode::kDec:
+    case interpreter::Bytecode::kNegate:
+    case interpreter::Bytecode::kBitwiseNot:
+      return 0;
+    case interpreter::Bytecode::kAdd:
+    case interpreter::Bytecode::kSub:
+    case interpreter::Bytecode::kMul:
+    case interpreter::Bytecode::kDiv:
+    case interpreter::Bytecode::kMod:
+    case interpreter::Bytecode::kExp:
+    case interpreter::Bytecode::kBitwiseOr:
+    case interpreter::Bytecode::kBitwiseXor:
+    case interpreter::Bytecode::kBitwiseAnd:
+    case interpreter::Bytecode::kShiftLeft:
+    case interpreter::Bytecode::kShiftRight:
+    case interpreter::Bytecode::kShiftRightLogical:
+    case interpreter::Bytecode::kAddSmi:
+    case interpreter::Bytecode::kSubSmi:
+    case interpreter::Bytecode::kMulSmi:
+    case interpreter::Bytecode::kDivSmi:
+    case interpreter::Bytecode::kModSmi:
+    case interpreter::Bytecode::kExpSmi:
+    case interpreter::Bytecode::kBitwiseOrSmi:
+    case interpreter::Bytecode::kBitwiseXorSmi:
+    case interpreter::Bytecode::kBitwiseAndSmi:
+    case interpreter::Bytecode::kShiftLeftSmi:
+    case interpreter::Bytecode::kShiftRightSmi:
+    case interpreter::Bytecode::kShiftRightLogicalSmi:
+    case interpreter::Bytecode::kTestEqual:
+    case interpreter::Bytecode::kTestEqualStrict:
+    case interpreter::Bytecode::kTestLessThan:
+    case interpreter::Bytecode::kTestGreaterThan:
+    case interpreter::Bytecode::kTestLessThanOrEqual:
+    case interpreter::Bytecode::kTestGreaterThanOrEqual:
+    case interpreter::Bytecode::kGetKeyedProperty:
+      return 1;
+    case interpreter::Bytecode::kGetNamedProperty:
+    case interpreter::Bytecode::kSetNamedProperty:
+    case interpreter::Bytecode::kSetKeyedProperty:
+      return 2;
+    default:
+      return {};
+  }
+}
+
+// Moves the feedback in {slot} to its most generic state, so that optimizing
+// compilers emit a generic operation instead of a speculative check. The
+// feedback stays generic since ICs never transition out of these states.
+bool PinFeedbackToGeneric(Isolate* isolate, Tagged<FeedbackVector> vector,
+                          FeedbackSlot slot) {
+  DisallowGarbageCollection no_gc;
+  FeedbackNexus nexus(isolate, vector, slot);
+  FeedbackSlotKind kind = nexus.kind();
+  if (kind == FeedbackSlotKind::kBinaryOp) {
+    vector->Set(slot, Smi::FromInt(BinaryOperationFeedback::kAny));
+    return true;
+  }
+  if (kind == FeedbackSlotKind::kCompareOp) {
+    vector->Set(slot, Smi::FromInt(CompareOperationFeedback::kAny));
+    return true;
+  }
+  if (IsLoadICKind(kind) || IsSetNamedICKind(kind)) {
+    return nexus.ConfigureMegamorphic(IcCheckType::kProperty);
+  }
+  if (IsKeyedLoadICKind(kind) || IsKeyedStoreICKind(kind)) {
+    return nexus.ConfigureMegamorphic(IcCheckType::kElement);
+  }
+  return false;
+}
+
 }  // namespace
 
 // We rely on this function not causing a GC.  It is called from generated code
@@ -1561,6 +1637,7 @@ void Deoptimizer::DoComputeOutputFrames() {
             CachedTieringDecision::kNormal);
       }
     }
+    if (v8_flags.deopt_loop_pinning) MaybePinFeedbackOnRepeatedDeopt();
     function_->reset_tiering_state();
     function_->SetInterruptBudget(isolate_, CodeKind::INTERPRETED_FUNCTION);
     function_->feedback_vector()->set_was_once_deoptimized();
@@ -1584,6 +1661,47 @@ void Deoptimizer::DoComputeOutputFrames() {
       stack_guard->real_jslimit() - kStackLimitSlackForDeoptimizationInBytes);
 }
 
+void Deoptimizer::MaybePinFeedbackOnRepeatedDeopt() {
+  if (deopt_kind_ != DeoptimizeKind::kEager) return;
+  Deoptimizer::DeoptInfo info = Deoptimizer::GetDeoptInfo();
+  // Only deopts originating in the function itself are attributed to its
+  // feedback; inlined sites would need the inlinee's feedback vector.
+  if (info.position.isInlined()) return;
+  if (IsDeoptimizationWithoutCodeInvalidation(info.deopt_reason)) return;
+
+  const int offset = bytecode_offset_in_outermost_frame_.ToInt();
+  static_assert(kDeoptimizeReasonCount <=
+                FeedbackVector::LastDeoptReasonBits::kMax + 1);
+  const uint8_t reason = static_cast<uint8_t>(info.deopt_reason);
+  Tagged<FeedbackVector> vector = function_->feedback_vector();
+  if (!vector->IsLastDeoptSite(offset, reason)) {
+    vector->set_last_deopt_site(offset, reason);
+    return;
+  }
+
+  // This is the second deopt in a row at the same site for the same reason.
+  HandleScope scope(isolate());
+  Handle<BytecodeArray> bytecode_array(
+      function_->shared()->GetBytecodeArray(isolate()), isolate());
+  if (!interpreter::BytecodeArrayIterator::IsValidOffset(bytecode_array,
+                                                         offset)) {
+    return;
+  }
+  interpreter::BytecodeArrayIterator it(bytecode_array, offset);
+  std::optional<int> operand_index =
+      PinnableFeedbackSlotOperandIndex(it.current_bytecode());
+  if (!operand_index.has_value()) return;
+  FeedbackSlot slot = it.GetSlotOperand(operand_index.value());
+  if (PinFeedbackToGeneric(isolate(), vector, slot) && tracing_enabled()) {
+    FILE* file = trace_scope()->file();
+    PrintF(file, "[pinned feedback slot %d of ", slot.ToInt());
+    ShortPrint(function_, file);
+    PrintF(file, " after repeated deopt at bytecode %d: %s]\n", offset,
+           DeoptimizeReasonToString(info.deopt_reason));
+  }
+  vector->clear_last_deopt_site();
+}
+
 // static
 bool Deoptimizer::DeoptExitIsInsideOsrLoop(Isolate* isolate,
                                            Tagged<JSFunction> function,
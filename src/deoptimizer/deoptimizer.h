@@ -175,6 +175,10 @@ class Deoptimizer : public Malloced {
 
   void DoComputeOutputFrames();
 
+  // Detects repeated eager deopts at the same site and generalizes that
+  // site's feedback. See --deopt-loop-pinning.
+  void MaybePinFeedbackOnRepeatedDeopt();
+
 #if V8_ENABLE_WEBASSEMBLY
   void DoComputeOutputFramesWasmImpl();
   FrameDescription* DoComputeWasmLiftoffFrame(
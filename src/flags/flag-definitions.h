@@ -561,9 +561,19 @@ DEFINE_BOOL(maglev_destroy_on_background, true,
             "Destroy compilation jobs on background thread")
 DEFINE_BOOL(maglev_inline_api_calls, false,
             "Inline CallApiCallback builtin into generated code")
+DEFINE_BOOL(maglev_polymorphic_inlining, false,
+            "dispatch on the target of calls to a small set of known "
+            "functions in Maglev, so that each target can be inlined")
+DEFINE_INT(max_maglev_polymorphic_inlining, 4,
+           "max number of targets of a polymorphic call site in Maglev")
+DEFINE_BOOL(maglev_inline_array_reduce, false,
+            "inline Array.prototype.reduce with an initial value into a loop "
+            "over fast elements in Maglev")
 DEFINE_EXPERIMENTAL_FEATURE(maglev_licm, "loop invariant code motion")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_polymorphic_inlining)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_array_reduce)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_escape_analysis)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_licm)
 // This might be too big of a hammer but we must prohibit moving the C++
@@ -1046,6 +1056,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_BOOL(concurrent_recompilation_prioritize_by_cost, false,
+            "dequeue concurrent recompilation jobs cheapest first (by "
+            "bytecode size, aged by enqueue order) instead of FIFO")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(concurrent_recompilation_front_running, true,
@@ -1312,6 +1325,9 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_profile_guided_block_layout, false,
+            "use branch hints (including those read from builtin profiles) to "
+            "lay out likely successors as fall-through blocks")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
@@ -1390,6 +1406,9 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_typed_array_loop_unrolling, false,
+            "allow Turboshaft to partially unroll larger JS loops that only "
+            "access TypedArray/DataView backing stores")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1471,12 +1490,22 @@ DEFINE_BOOL_READONLY(turboshaft_trace_intermediate_reductions, false,
 DEFINE_BOOL(profile_guided_optimization, true, "profile guided optimization")
 DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
+DEFINE_BOOL(code_cache_tiering_decisions, false,
+            "keep the cached tiering decisions of functions (e.g. early "
+            "Maglev/Turbofan) in the code cache, so that functions which were "
+            "hot when the cache was created tier up early after it is "
+            "consumed; optimized code itself is still compiled against the "
+            "current heap state")
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
 DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
            "invocation count for maglev for functions which according to "
            "profile_guided_optimization are likely to deoptimize before "
            "reaching this invocation count")
+DEFINE_BOOL(deopt_loop_pinning, false,
+            "when optimized code deoptimizes twice in a row at the same "
+            "bytecode for the same reason, pin that site's feedback to its "
+            "generic state so re-optimized code stops speculating there")
 
 // Favor memory over execution speed.
 DEFINE_BOOL(optimize_for_size, false,
@@ -1574,6 +1603,13 @@ DEFINE_INT(
     wasm_caching_timeout_ms, 2000,
     "only trigger caching if no new code was compiled within this timeout (0 "
     "to disable this logic and only use --wasm-caching-threshold)")
+DEFINE_BOOL(wasm_serialize_without_turbofan_code, false,
+            "allow serializing wasm modules before any function reached "
+            "TurboFan; executed Liftoff functions are recorded so that they "
+            "get compiled eagerly after deserialization")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "defer copying and relocating deserialized TurboFan code until "
+            "the first call of each function")
 DEFINE_BOOL(trace_wasm_compilation_times, false,
             "print how long it took to compile each wasm function")
 DEFINE_INT(wasm_tier_up_filter, -1, "only tier-up function with this index")
@@ -1595,6 +1631,9 @@ DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
 DEFINE_NEG_IMPLICATION(fuzzing, liftoff_only)
+DEFINE_BOOL(liftoff_loop_locals_in_registers, false,
+            "keep locals in registers across loop headers in Liftoff, as long "
+            "as enough registers remain for the loop body")
 DEFINE_DEBUG_BOOL(
     enable_testing_opcode_in_wasm, false,
     "enables a testing opcode in wasm that is only implemented in TurboFan")
@@ -1627,6 +1666,13 @@ DEFINE_NEG_IMPLICATION(experimental_wasm_pgo_to_file, single_threaded)
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_BOOL(experimental_wasm_pgo_streaming, false,
+            "experimental: also dump tiering PGO data keyed by the module "
+            "prefix, and apply it at the start of the code section during "
+            "streaming compilation, so hot functions get compiled with "
+            "TurboFan while the rest of the module is still downloading")
+DEFINE_IMPLICATION(experimental_wasm_pgo_streaming,
+                   experimental_wasm_pgo_from_file)
 
 DEFINE_BOOL(validate_asm, true,
             "validate asm.js modules and translate them to Wasm")
@@ -1738,6 +1784,9 @@ DEFINE_BOOL(trace_wasm_typer, false, "trace wasm typer")
 
 DEFINE_BOOL(wasm_loop_unrolling, true,
             "enable loop unrolling for wasm functions")
+DEFINE_BOOL(wasm_inline_bulk_memory, false,
+            "lower memory.copy and memory.fill with a small constant size to "
+            "inline loads and stores in Turboshaft")
 DEFINE_BOOL(wasm_loop_peeling, true, "enable loop peeling for wasm functions")
 DEFINE_SIZE_T(wasm_loop_peeling_max_size, 1000, "maximum size for peeling")
 DEFINE_BOOL(trace_wasm_loop_peeling, false, "trace wasm loop peeling")
@@ -1765,6 +1814,10 @@ DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_code_compaction, false,
+            "reuse wasm code space freed by the code GC, and relocate live "
+            "optimized code into it to keep code space compact")
+DEFINE_NEG_NEG_IMPLICATION(wasm_code_gc, wasm_code_compaction)
 DEFINE_INT(wasm_max_initial_code_space_reservation, 0,
            "maximum size of the initial wasm code space reservation (in MB)")
 DEFINE_BOOL(stress_wasm_memory_moving, false,
@@ -2687,6 +2740,11 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_dfa, false,
+            "find match bounds with a lazily built DFA in the experimental "
+            "regexp engine")
+DEFINE_IMPLICATION(experimental_regexp_engine_dfa,
+                   enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
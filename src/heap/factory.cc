@@ -453,6 +453,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_invocation_count_before_stable(0);
   vector->reset_osr_state();
   vector->reset_flags();
+  vector->clear_last_deopt_site();
   vector->set_log_next_execution(v8_flags.log_function_events);
   vector->set_closure_feedback_cell_array(*closure_feedback_cell_array);
   vector->set_parent_feedback_cell(*parent_feedback_cell);
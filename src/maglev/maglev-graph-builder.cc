@@ -410,6 +410,7 @@ class V8_NODISCARD MaglevGraphBuilder::DeoptFrameScope {
       case Builtin::kGetIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kCallIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kArrayForEachLoopLazyDeoptContinuation:
+      case Builtin::kArrayReduceLoopLazyDeoptContinuation:
       case Builtin::kGenericLazyDeoptContinuation:
       case Builtin::kToBooleanLazyDeoptContinuation:
         return true;
@@ -7430,78 +7431,48 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayIsArray(
   return ReduceResult::Fail();
 }
 
-ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
-    compiler::JSFunctionRef target, CallArguments& args) {
-  if (!CanSpeculateCall()) {
-    return ReduceResult::Fail();
-  }
-
+template <typename GetEagerDeoptScopeCallback,
+          typename GetLazyDeoptScopeCallback, typename BuildCallCallback>
+ReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
+    const char* name, compiler::JSFunctionRef target, CallArguments& args,
+    ValueNode* initial_accumulator,
+    GetEagerDeoptScopeCallback&& get_eager_deopt_scope,
+    GetLazyDeoptScopeCallback&& get_lazy_deopt_scope,
+    BuildCallCallback&& build_call) {
+  DCHECK_GE(args.count(), 1);
   ValueNode* receiver = args.receiver();
-  if (!receiver) return ReduceResult::Fail();
-
-  if (args.count() < 1) {
-    if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - not enough "
-                   "arguments"
-                << std::endl;
-    }
-    return ReduceResult::Fail();
-  }
+  DCHECK_NOT_NULL(receiver);
 
   auto node_info = known_node_aspects().TryGetInfoFor(receiver);
   if (!node_info || !node_info->possible_maps_are_known()) {
-    if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - receiver "
-                   "map is unknown"
-                << std::endl;
-    }
-    return ReduceResult::Fail();
+    FAIL(name << " - receiver map is unknown");
   }
 
   ElementsKind elements_kind;
   if (!CanInlineArrayIteratingBuiltin(broker(), node_info->possible_maps(),
                                       &elements_kind)) {
-    if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - doesn't "
-                   "support fast array iteration or incompatible maps"
-                << std::endl;
-    }
-    return ReduceResult::Fail();
+    FAIL(name << " - doesn't support fast array iteration or incompatible "
+                 "maps");
   }
 
   // TODO(leszeks): May only be needed for holey elements kinds.
   if (!broker()->dependencies()->DependOnNoElementsProtector()) {
-    if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - invalidated "
-                   "no elements protector"
-                << std::endl;
-    }
-    return ReduceResult::Fail();
+    FAIL(name << " - invalidated no elements protector");
   }
 
   ValueNode* callback = args[0];
   if (!callback->is_tagged()) {
-    if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - callback is "
-                   "untagged value"
-                << std::endl;
-    }
-    return ReduceResult::Fail();
+    FAIL(name << " - callback is untagged value");
   }
 
-  ValueNode* this_arg =
-      args.count() > 1 ? args[1] : GetRootConstant(RootIndex::kUndefinedValue);
-
   ValueNode* original_length = BuildLoadJSArrayLength(receiver);
 
   // Elide the callable check if the node is known callable.
   EnsureType(callback, NodeType::kCallable, [&](NodeType old_type) {
     // ThrowIfNotCallable is wrapped in a lazy_deopt_scope to make sure the
     // exception has the right call stack.
-    DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>({receiver, callback, this_arg,
-                                    GetSmiConstant(0), original_length}));
+    DeoptFrameScope lazy_deopt_scope =
+        get_lazy_deopt_scope(GetSmiConstant(0), original_length);
     AddNewNode<ThrowIfNotCallable>({callback});
   });
 
@@ -7511,21 +7482,31 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   bool receiver_maps_were_unstable = node_info->possible_maps_are_unstable();
   PossibleMaps receiver_maps_before_loop(node_info->possible_maps());
 
-  // Create a sub graph builder with two variable (index and length)
-  MaglevSubGraphBuilder sub_builder(this, 2);
+  // Create a sub graph builder with two variables (index and length), and a
+  // third one for the accumulator if there is one.
+  const bool has_accumulator = initial_accumulator != nullptr;
+  MaglevSubGraphBuilder sub_builder(this, has_accumulator ? 3 : 2);
   MaglevSubGraphBuilder::Variable var_index(0);
   MaglevSubGraphBuilder::Variable var_length(1);
+  MaglevSubGraphBuilder::Variable var_accumulator(2);
 
-  MaglevSubGraphBuilder::Label loop_end(&sub_builder, 1);
+  MaglevSubGraphBuilder::Label loop_end =
+      has_accumulator
+          ? MaglevSubGraphBuilder::Label(&sub_builder, 1, {&var_accumulator})
+          : MaglevSubGraphBuilder::Label(&sub_builder, 1);
 
   // ```
   // index = 0
+  // accumulator = initial_accumulator
   // bind loop_header
   // ```
   sub_builder.set(var_index, GetSmiConstant(0));
   sub_builder.set(var_length, original_length);
+  if (has_accumulator) sub_builder.set(var_accumulator, initial_accumulator);
   MaglevSubGraphBuilder::LoopLabel loop_header =
-      sub_builder.BeginLoop({&var_index, &var_length});
+      has_accumulator
+          ? sub_builder.BeginLoop({&var_index, &var_length, &var_accumulator})
+          : sub_builder.BeginLoop({&var_index, &var_length});
 
   // Reset known state that is cleared by BeginLoop, but is known to be true on
   // the first iteration, and will be re-checked at the end of the loop.
@@ -7555,6 +7536,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   Phi* index_tagged = sub_builder.get(var_index)->Cast<Phi>();
   EnsureType(index_tagged, NodeType::kSmi);
   ValueNode* index_int32 = GetInt32(index_tagged);
+  ValueNode* accumulator =
+      has_accumulator ? sub_builder.get(var_accumulator) : nullptr;
 
   sub_builder.GotoIfFalse<BranchIfInt32Compare>(
       &loop_end, {index_int32, original_length_int32}, Operation::kLessThan);
@@ -7568,10 +7551,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // TODO(pthier): In practice this increment can never overflow, as the max
     // possible array length is less than int32 max value. Add a new
     // Int32Increment that asserts no overflow instead of deopting.
-    DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, index_int32, original_length}));
+    DeoptFrameScope eager_deopt_scope =
+        get_eager_deopt_scope(index_int32, original_length, accumulator);
     next_index_int32 = AddNewNode<Int32IncrementWithOverflow>({index_int32});
     EnsureType(next_index_int32, NodeType::kSmi);
   }
@@ -7595,7 +7576,11 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // ```
     skip_call.emplace(
         &sub_builder, 2,
-        std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+        has_accumulator
+            ? std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+                  &var_length, &var_accumulator}
+            : std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+                  &var_length});
     if (elements_kind == HOLEY_DOUBLE_ELEMENTS) {
       sub_builder.GotoIfTrue<BranchIfFloat64IsHole>(&*skip_call, {element});
     } else {
@@ -7605,24 +7590,13 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   }
 
   // ```
-  // callback(this_arg, element, array)
+  // [accumulator =] callback(..., element, index, array)
   // ```
   ReduceResult result;
   {
-    DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
-
-    CallArguments call_args =
-        args.count() < 2
-            ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
-                            {element, index_tagged, receiver})
-            : CallArguments(ConvertReceiverMode::kAny,
-                            {this_arg, element, index_tagged, receiver});
-
-    SaveCallSpeculationScope saved(this);
-    result = ReduceCall(callback, call_args, saved.value());
+    DeoptFrameScope lazy_deopt_scope =
+        get_lazy_deopt_scope(next_index_int32, original_length);
+    result = build_call(element, index_tagged, accumulator);
   }
 
   // ```
@@ -7633,6 +7607,11 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
 
   // No need to finish the loop if this code is unreachable.
   if (!result.IsDoneWithAbort()) {
+    if (has_accumulator) {
+      accumulator = GetTaggedValue(result.value());
+      sub_builder.set(var_accumulator, accumulator);
+    }
+
     // If any of the receiver's maps were unstable maps, we have to re-check the
     // maps on each iteration, in case the callback changed them. That said, we
     // know that the maps are valid on the first iteration, so we can rotate the
@@ -7656,10 +7635,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
 
     // Make sure to finish the loop if we eager deopt in the map check or index
     // check.
-    DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
+    DeoptFrameScope eager_deopt_scope =
+        get_eager_deopt_scope(next_index_int32, original_length, accumulator);
 
     if (recheck_maps_after_call) {
       // Build the CheckMap manually, since we're doing it with already known
@@ -7707,9 +7684,113 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   // ```
   sub_builder.Bind(&loop_end);
 
+  if (has_accumulator) return sub_builder.get(var_accumulator);
   return GetRootConstant(RootIndex::kUndefinedValue);
 }
 
+ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (!CanSpeculateCall()) {
+    return ReduceResult::Fail();
+  }
+
+  ValueNode* receiver = args.receiver();
+  if (!receiver) return ReduceResult::Fail();
+
+  if (args.count() < 1) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce Array.prototype.forEach - not enough "
+                   "arguments"
+                << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
+  ValueNode* callback = args[0];
+  ValueNode* this_arg =
+      args.count() > 1 ? args[1] : GetRootConstant(RootIndex::kUndefinedValue);
+
+  auto get_eager_deopt_scope = [&](ValueNode* index, ValueNode* length,
+                                   ValueNode* accumulator) {
+    return DeoptFrameScope(
+        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
+        base::VectorOf<ValueNode*>(
+            {receiver, callback, this_arg, index, length}));
+  };
+  auto get_lazy_deopt_scope = [&](ValueNode* index, ValueNode* length) {
+    return DeoptFrameScope(
+        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
+        base::VectorOf<ValueNode*>(
+            {receiver, callback, this_arg, index, length}));
+  };
+  auto build_call = [&](ValueNode* element, ValueNode* index,
+                        ValueNode* accumulator) {
+    // ```
+    // callback(this_arg, element, index, array)
+    // ```
+    CallArguments call_args =
+        args.count() < 2
+            ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
+                            {element, index, receiver})
+            : CallArguments(ConvertReceiverMode::kAny,
+                            {this_arg, element, index, receiver});
+
+    SaveCallSpeculationScope saved(this);
+    return ReduceCall(callback, call_args, saved.value());
+  };
+
+  return TryReduceArrayIteratingBuiltin(
+      "Array.prototype.forEach", target, args, nullptr, get_eager_deopt_scope,
+      get_lazy_deopt_scope, build_call);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayReduce(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  if (!v8_flags.maglev_inline_array_reduce) return ReduceResult::Fail();
+  if (!CanSpeculateCall()) return ReduceResult::Fail();
+
+  ValueNode* receiver = args.receiver();
+  if (!receiver) return ReduceResult::Fail();
+
+  // Without an initial value, the accumulator starts at the first non-hole
+  // element, which requires a separate search loop; leave that to the
+  // builtin.
+  if (args.count() < 2) {
+    FAIL("no initial value");
+  }
+
+  ValueNode* callback = args[0];
+
+  auto get_eager_deopt_scope = [&](ValueNode* index, ValueNode* length,
+                                   ValueNode* accumulator) {
+    return DeoptFrameScope(
+        this, Builtin::kArrayReduceLoopEagerDeoptContinuation, target,
+        base::VectorOf<ValueNode*>(
+            {receiver, callback, index, length, accumulator}));
+  };
+  // The accumulator is the result of the lazily deoptimizing call.
+  auto get_lazy_deopt_scope = [&](ValueNode* index, ValueNode* length) {
+    return DeoptFrameScope(
+        this, Builtin::kArrayReduceLoopLazyDeoptContinuation, target,
+        base::VectorOf<ValueNode*>({receiver, callback, index, length}));
+  };
+  auto build_call = [&](ValueNode* element, ValueNode* index,
+                        ValueNode* accumulator) {
+    // ```
+    // accumulator = callback(undefined, accumulator, element, index, array)
+    // ```
+    CallArguments call_args(ConvertReceiverMode::kNullOrUndefined,
+                            {accumulator, element, index, receiver});
+
+    SaveCallSpeculationScope saved(this);
+    return ReduceCall(callback, call_args, saved.value());
+  };
+
+  return TryReduceArrayIteratingBuiltin(
+      "Array.prototype.reduce", target, args, GetTaggedValue(args[1]),
+      get_eager_deopt_scope, get_lazy_deopt_scope, build_call);
+}
+
 ReduceResult MaglevGraphBuilder::TryReduceArrayIteratorPrototypeNext(
     compiler::JSFunctionRef target, CallArguments& args) {
   if (!CanSpeculateCall()) {
@@ -9712,6 +9793,84 @@ ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLike(
   return BuildGenericCall(target_node, Call::TargetType::kAny, args);
 }
 
+// Calls through a target that is a phi of a small number of known functions
+// (typically the result of a polymorphic method load) are dispatched on the
+// target, so that each of the functions can be called directly or inlined.
+// Inlining uses the same budgets as monomorphic call sites.
+ReduceResult MaglevGraphBuilder::TryReducePolymorphicCall(
+    Phi* target_phi, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source) {
+  if (!v8_flags.maglev_polymorphic_inlining) return ReduceResult::Fail();
+  if (target_phi->is_exception_phi() || target_phi->is_loop_phi()) {
+    return ReduceResult::Fail();
+  }
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+
+  base::SmallVector<compiler::JSFunctionRef, 4> targets;
+  for (int i = 0; i < target_phi->input_count(); i++) {
+    compiler::OptionalHeapObjectRef maybe_constant =
+        TryGetConstant(target_phi->input(i).node());
+    if (!maybe_constant.has_value() || !maybe_constant->IsJSFunction()) {
+      return ReduceResult::Fail();
+    }
+    compiler::JSFunctionRef target = maybe_constant->AsJSFunction();
+    if (std::none_of(targets.begin(), targets.end(),
+                     [&](compiler::JSFunctionRef other) {
+                       return other.equals(target);
+                     })) {
+      targets.push_back(target);
+    }
+  }
+  if (targets.size() < 2 ||
+      targets.size() >
+          static_cast<size_t>(v8_flags.max_maglev_polymorphic_inlining)) {
+    return ReduceResult::Fail();
+  }
+
+  TRACE_INLINING("  dispatching polymorphic call to " << targets.size()
+                                                      << " targets");
+
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable ret_val(0);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, static_cast<int>(targets.size()),
+      std::initializer_list<MaglevSubGraphBuilder::Variable*>{&ret_val});
+
+  for (size_t i = 0; i < targets.size(); i++) {
+    std::optional<MaglevSubGraphBuilder::Label> check_next_target;
+    // The phi can only produce one of its inputs, so the last target doesn't
+    // need to be checked.
+    if (i != targets.size() - 1) {
+      check_next_target.emplace(&sub_graph, 1);
+      sub_graph.GotoIfFalse<BranchIfReferenceEqual>(
+          &*check_next_target, {target_phi, GetConstant(targets[i])});
+    }
+
+    // Reducers may modify the arguments, so each target gets its own copy.
+    CallArguments target_args = args;
+    ReduceResult result =
+        ReduceCallForConstant(targets[i], target_args, feedback_source);
+    if (result.IsFail()) {
+      result = BuildGenericCall(GetConstant(targets[i]),
+                                Call::TargetType::kAny, args);
+    }
+    DCHECK(result.IsDone());
+    if (result.IsDoneWithValue()) {
+      sub_graph.set(ret_val, result.value());
+      sub_graph.Goto(&done);
+    } else {
+      DCHECK(result.IsDoneWithAbort());
+    }
+
+    if (check_next_target.has_value()) {
+      sub_graph.Bind(&*check_next_target);
+    }
+  }
+
+  RETURN_IF_ABORT(sub_graph.TrimPredecessorsAndBind(&done));
+  return sub_graph.get(ret_val);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCall(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source) {
@@ -9724,6 +9883,12 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
     }
   }
 
+  if (Phi* target_phi = target_node->TryCast<Phi>()) {
+    ReduceResult result =
+        TryReducePolymorphicCall(target_phi, args, feedback_source);
+    RETURN_IF_DONE(result);
+  }
+
   // If the implementation here becomes more complex, we could probably
   // deduplicate the code for FastCreateClosure and CreateClosure by using
   // templates or giving them a shared base class.
@@ -1900,6 +1900,7 @@ class MaglevGraphBuilder {
 #define MAGLEV_REDUCED_BUILTIN(V)              \
   V(ArrayConstructor)                          \
   V(ArrayForEach)                              \
+  V(ArrayReduce)                               \
   V(ArrayIsArray)                              \
   V(ArrayIteratorPrototypeNext)                \
   V(ArrayPrototypeEntries)                     \
@@ -1945,6 +1946,20 @@ class MaglevGraphBuilder {
 
   ReduceResult TryReduceGetProto(ValueNode* node);
 
+  // Builds a loop that calls args[0] on every element of a fast JSArray
+  // receiver, for Array.prototype builtins like forEach and reduce. The
+  // deopt scope callbacks create the builtin continuation frames for a given
+  // index. If `initial_accumulator` is not null, the result of each call is
+  // passed to the next one and is the result of the loop.
+  template <typename GetEagerDeoptScopeCallback,
+            typename GetLazyDeoptScopeCallback, typename BuildCallCallback>
+  ReduceResult TryReduceArrayIteratingBuiltin(
+      const char* name, compiler::JSFunctionRef target, CallArguments& args,
+      ValueNode* initial_accumulator,
+      GetEagerDeoptScopeCallback&& get_eager_deopt_scope,
+      GetLazyDeoptScopeCallback&& get_lazy_deopt_scope,
+      BuildCallCallback&& build_call);
+
   template <typename MapKindsT, typename IndexToElementsKindFunc,
             typename BuildKindSpecificFunc>
   ReduceResult BuildJSArrayBuiltinMapSwitchOnElementsKind(
@@ -2021,6 +2036,9 @@ class MaglevGraphBuilder {
   ReduceResult ReduceCallWithArrayLike(
       ValueNode* target_node, CallArguments& args,
       const compiler::FeedbackSource& feedback_source);
+  ReduceResult TryReducePolymorphicCall(
+      Phi* target_phi, CallArguments& args,
+      const compiler::FeedbackSource& feedback_source);
   ReduceResult ReduceCall(ValueNode* target_node, CallArguments& args,
                           const compiler::FeedbackSource& feedback_source =
                               compiler::FeedbackSource());
@@ -263,6 +263,22 @@ void FeedbackVector::set_was_once_deoptimized() {
                                      kRelaxedStore);
 }
 
+bool FeedbackVector::IsLastDeoptSite(int bytecode_offset,
+                                     uint8_t reason) const {
+  return last_deopt_bytecode_offset() == bytecode_offset &&
+         LastDeoptReasonBits::decode(flags()) == reason;
+}
+
+void FeedbackVector::set_last_deopt_site(int bytecode_offset,
+                                         uint8_t reason) {
+  set_last_deopt_bytecode_offset(bytecode_offset);
+  set_flags(LastDeoptReasonBits::update(flags(), reason));
+}
+
+void FeedbackVector::clear_last_deopt_site() {
+  set_last_deopt_site(BytecodeOffset::None().ToInt(), 0);
+}
+
 std::optional<Tagged<Code>> FeedbackVector::GetOptimizedOsrCode(
     Isolate* isolate, FeedbackSlot slot) {
   Tagged<MaybeObject> maybe_code = Get(isolate, slot);
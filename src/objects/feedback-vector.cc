@@ -454,7 +454,8 @@ void FeedbackVector::reset_flags() {
             MaybeHasTurbofanCodeBit::encode(false) |
             OsrTieringInProgressBit::encode(false) |
             MaybeHasMaglevOsrCodeBit::encode(false) |
-            MaybeHasTurbofanOsrCodeBit::encode(false));
+            MaybeHasTurbofanOsrCodeBit::encode(false) |
+            LastDeoptReasonBits::encode(0));
 }
 
 bool FeedbackVector::osr_tiering_in_progress() {
@@ -326,6 +326,12 @@ class FeedbackVector
   inline bool was_once_deoptimized() const;
   inline void set_was_once_deoptimized();
 
+  // Site (bytecode offset and reason) of the most recent eager
+  // deoptimization. See --deopt-loop-pinning.
+  inline bool IsLastDeoptSite(int bytecode_offset, uint8_t reason) const;
+  inline void set_last_deopt_site(int bytecode_offset, uint8_t reason);
+  inline void clear_last_deopt_site();
+
   void reset_flags();
 
   // Conversion from a slot to an integer index to the underlying array.
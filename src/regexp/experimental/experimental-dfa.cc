@@ -0,0 +1,521 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+
+#include "src/base/functional.h"
+#include "src/execution/isolate.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Upper bound for the memory used by the states and transitions of each of the
+// two state caches.
+constexpr size_t kMaxCacheSize = 256 * KB;
+
+// A full cache is only cleared if at least this many characters per cached
+// state were processed since it was last cleared.  Otherwise the DFA gives up,
+// since it would hardly be faster than the NFA.
+constexpr size_t kMinStepsPerStateBeforeClear = 10;
+
+constexpr int kMinHashTableSize = 16;
+
+// Same interval as in the NFA interpreter.
+constexpr int kTicksBetweenInterruptChecks = 64;
+
+bool InterruptRequested(Isolate* isolate) {
+  StackLimitCheck check(isolate);
+  return check.InterruptRequested();
+}
+
+// Calls `f` with the PCs that the instruction at `pc` continues at without
+// consuming input.
+template <class F>
+void ForEachEpsilonSuccessor(const RegExpInstruction& inst, int pc, F&& f) {
+  switch (inst.opcode) {
+    case RegExpInstruction::FORK:
+      f(pc + 1);
+      f(inst.payload.pc);
+      break;
+    case RegExpInstruction::JMP:
+      f(inst.payload.pc);
+      break;
+    case RegExpInstruction::SET_REGISTER_TO_CP:
+    case RegExpInstruction::CLEAR_REGISTER:
+    case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+    case RegExpInstruction::BEGIN_LOOP:
+    case RegExpInstruction::END_LOOP:
+      f(pc + 1);
+      break;
+    case RegExpInstruction::CONSUME_RANGE:
+    case RegExpInstruction::ACCEPT:
+      break;
+    default:
+      UNREACHABLE();
+  }
+}
+
+// Splits the characters into classes such that every CONSUME_RANGE in `code`
+// either contains all or none of the characters of a class.  Returns the
+// sorted smallest characters of the classes.
+ZoneVector<base::uc16> ComputeClassStarts(
+    base::Vector<const RegExpInstruction> code, Zone* zone) {
+  ZoneVector<base::uc16> starts(zone);
+  starts.push_back(0);
+  for (const RegExpInstruction& inst : code) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+    // Skip the empty range of `RegExpInstruction::Fail()`.
+    if (range.min > range.max) continue;
+    starts.push_back(range.min);
+    if (range.max != 0xFFFF) starts.push_back(range.max + 1);
+  }
+  std::sort(starts.begin(), starts.end());
+  starts.resize(std::unique(starts.begin(), starts.end()) - starts.begin());
+  return starts;
+}
+
+}  // namespace
+
+ExperimentalRegExpDfa::StateCache::StateCache(Zone* zone, int class_count)
+    : class_count_(class_count),
+      max_states_(static_cast<int>(std::max<size_t>(
+          kMinHashTableSize,
+          kMaxCacheSize / (class_count * sizeof(int) + sizeof(StateInfo))))),
+      states_(zone),
+      pcs_(zone),
+      transitions_(zone),
+      table_(kMinHashTableSize, kUnknownState, zone) {}
+
+size_t ExperimentalRegExpDfa::StateCache::Hash(base::Vector<const int> pcs,
+                                               bool is_match) const {
+  return base::hash_combine(base::hash_range(pcs.begin(), pcs.end()),
+                            is_match);
+}
+
+bool ExperimentalRegExpDfa::StateCache::Equals(int state,
+                                               base::Vector<const int> pcs,
+                                               bool is_match) const {
+  return states_[state].is_match == is_match && this->pcs(state) == pcs;
+}
+
+int ExperimentalRegExpDfa::StateCache::Intern(base::Vector<const int> pcs,
+                                              bool is_match) {
+  size_t mask = table_.size() - 1;
+  size_t index = Hash(pcs, is_match) & mask;
+  for (; table_[index] != kUnknownState; index = (index + 1) & mask) {
+    if (Equals(table_[index], pcs, is_match)) return table_[index];
+  }
+
+  if (size() == max_states_ ||
+      pcs_.size() + pcs.size() > kMaxCacheSize / sizeof(int)) {
+    return kCacheFull;
+  }
+
+  const int state = size();
+  states_.push_back(
+      {static_cast<int>(pcs_.size()), static_cast<int>(pcs.size()), is_match});
+  for (int pc : pcs) pcs_.push_back(pc);
+  transitions_.resize(transitions_.size() + class_count_, kUnknownState);
+  table_[index] = state;
+
+  // Keep the load factor of the hash table below 1/2.
+  if (2 * states_.size() > table_.size()) {
+    table_.assign(2 * table_.size(), kUnknownState);
+    mask = table_.size() - 1;
+    for (int s = 0; s < size(); ++s) {
+      index = Hash(this->pcs(s), this->is_match(s)) & mask;
+      while (table_[index] != kUnknownState) index = (index + 1) & mask;
+      table_[index] = s;
+    }
+  }
+  return state;
+}
+
+void ExperimentalRegExpDfa::StateCache::Clear() {
+  states_.clear();
+  pcs_.clear();
+  transitions_.clear();
+  std::fill(table_.begin(), table_.end(), kUnknownState);
+  start_state_ = kUnknownState;
+}
+
+// static
+ExperimentalRegExpDfa* ExperimentalRegExpDfa::TryCreate(
+    base::Vector<const RegExpInstruction> bytecode, Zone* zone) {
+  int body_start_pc = -1;
+  int accept_pc = -1;
+  for (int pc = 0; pc < bytecode.length(); ++pc) {
+    const RegExpInstruction& inst = bytecode[pc];
+    if (accept_pc != -1) {
+      // Only the capture group filters, which are not executed while
+      // searching, may follow the main expression.  Anything else belongs to
+      // a lookbehind.
+      if (!RegExpInstruction::IsFilter(inst)) return nullptr;
+      continue;
+    }
+    switch (inst.opcode) {
+      case RegExpInstruction::ACCEPT:
+        accept_pc = pc;
+        break;
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+        if (inst.payload.register_index == 0) body_start_pc = pc;
+        break;
+      case RegExpInstruction::CONSUME_RANGE:
+      case RegExpInstruction::FORK:
+      case RegExpInstruction::JMP:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+      case RegExpInstruction::BEGIN_LOOP:
+      case RegExpInstruction::END_LOOP:
+        break;
+      case RegExpInstruction::ASSERTION:
+        // Assertions depend on the characters around the current position,
+        // which DFA states don't record.
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::FILTER_QUANTIFIER:
+      case RegExpInstruction::FILTER_GROUP:
+      case RegExpInstruction::FILTER_CHILD:
+        return nullptr;
+    }
+  }
+  if (accept_pc == -1 || body_start_pc == -1) return nullptr;
+
+  for (int pc = 0; pc < accept_pc; ++pc) {
+    const RegExpInstruction& inst = bytecode[pc];
+    if ((inst.opcode == RegExpInstruction::FORK ||
+         inst.opcode == RegExpInstruction::JMP) &&
+        (inst.payload.pc < 0 || inst.payload.pc > accept_pc)) {
+      return nullptr;
+    }
+  }
+
+  // The bytecode object may move during GC, so the DFA keeps its own copy.
+  base::Vector<const RegExpInstruction> code =
+      zone->CloneVector(bytecode.SubVector(0, accept_pc + 1));
+  return zone->New<ExperimentalRegExpDfa>(code, body_start_pc, zone);
+}
+
+ExperimentalRegExpDfa::ExperimentalRegExpDfa(
+    base::Vector<const RegExpInstruction> code, int body_start_pc, Zone* zone)
+    : code_(code),
+      body_start_pc_(body_start_pc),
+      accept_pc_(code.length() - 1),
+      epsilon_predecessor_offsets_(code.length() + 1, 0, zone),
+      epsilon_predecessors_(zone),
+      class_starts_(ComputeClassStarts(code, zone)),
+      latin1_classes_(kLatin1ClassTableSize, 0, zone),
+      forward_cache_(zone, static_cast<int>(class_starts_.size())),
+      backward_cache_(zone, static_cast<int>(class_starts_.size())),
+      threads_(zone),
+      next_pcs_(zone),
+      visited_(2 * code.length(), 0, zone),
+      blocked_(code.length(), 0, zone) {
+  DCHECK_EQ(code_[accept_pc_].opcode, RegExpInstruction::ACCEPT);
+
+  for (int c = 0; c < kLatin1ClassTableSize; ++c) {
+    latin1_classes_[c] =
+        static_cast<int>(std::upper_bound(class_starts_.begin(),
+                                          class_starts_.end(), c) -
+                         class_starts_.begin()) -
+        1;
+  }
+
+  // Invert the epsilon edges, first counting the predecessors of every PC.
+  for (int pc = 0; pc < code_.length(); ++pc) {
+    ForEachEpsilonSuccessor(code_[pc], pc, [&](int successor) {
+      ++epsilon_predecessor_offsets_[successor + 1];
+    });
+  }
+  for (int pc = 0; pc < code_.length(); ++pc) {
+    epsilon_predecessor_offsets_[pc + 1] += epsilon_predecessor_offsets_[pc];
+  }
+  epsilon_predecessors_.resize(epsilon_predecessor_offsets_.back());
+  ZoneVector<int> next_index(epsilon_predecessor_offsets_.begin(),
+                             epsilon_predecessor_offsets_.end() - 1, zone);
+  for (int pc = 0; pc < code_.length(); ++pc) {
+    ForEachEpsilonSuccessor(code_[pc], pc, [&](int successor) {
+      epsilon_predecessors_[next_index[successor]++] = pc;
+    });
+  }
+}
+
+template <class Character>
+int ExperimentalRegExpDfa::CharacterClass(Character c) const {
+  if constexpr (sizeof(Character) == 1) {
+    return latin1_classes_[c];
+  } else {
+    if (c < kLatin1ClassTableSize) return latin1_classes_[c];
+    return static_cast<int>(std::upper_bound(class_starts_.begin(),
+                                             class_starts_.end(), c) -
+                            class_starts_.begin()) -
+           1;
+  }
+}
+
+bool ExperimentalRegExpDfa::Visit(int pc, bool consumed) {
+  uint32_t& visited = visited_[2 * pc + (consumed ? 1 : 0)];
+  if (visited == step_) return false;
+  visited = step_;
+  return true;
+}
+
+bool ExperimentalRegExpDfa::ConsumesAt(int pc, base::uc16 c) const {
+  DCHECK_EQ(code_[pc].opcode, RegExpInstruction::CONSUME_RANGE);
+  RegExpInstruction::Uc16Range range = code_[pc].payload.consume_range;
+  return range.min <= c && c <= range.max;
+}
+
+// Runs `threads_` like `NfaInterpreter::RunActiveThreads` does, i.e. the last
+// thread has the highest priority, and threads forked by a thread are run
+// right after it.  The PCs of the threads which block on a CONSUME_RANGE are
+// written to `next_pcs_` from high to low priority.
+bool ExperimentalRegExpDfa::RunForwardThreads() {
+  while (!threads_.empty()) {
+    Thread t = threads_.back();
+    threads_.pop_back();
+    bool alive = true;
+    while (alive && Visit(t.pc, t.consumed)) {
+      const RegExpInstruction& inst = code_[t.pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          // Of several threads blocked at the same PC, only the one with the
+          // highest priority can get past the PC after the next character.
+          if (blocked_[t.pc] != step_) {
+            blocked_[t.pc] = step_;
+            next_pcs_.push_back(t.pc);
+          }
+          alive = false;
+          break;
+        case RegExpInstruction::ACCEPT:
+          // Threads with lower priority than an ACCEPTing thread are
+          // discarded.
+          threads_.clear();
+          return true;
+        case RegExpInstruction::FORK:
+          threads_.push_back({inst.payload.pc, t.consumed});
+          ++t.pc;
+          break;
+        case RegExpInstruction::JMP:
+          t.pc = inst.payload.pc;
+          break;
+        case RegExpInstruction::BEGIN_LOOP:
+          t.consumed = false;
+          ++t.pc;
+          break;
+        case RegExpInstruction::END_LOOP:
+          // Quantifier iterations must not match the empty string.
+          alive = t.consumed;
+          ++t.pc;
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+        case RegExpInstruction::CLEAR_REGISTER:
+        case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+          ++t.pc;
+          break;
+        default:
+          UNREACHABLE();
+      }
+    }
+  }
+  return false;
+}
+
+// Adds the PCs in `threads_` and all PCs from which they can be reached without
+// consuming input to the current backward state.  The CONSUME_RANGEs from which
+// one of these PCs can be reached by consuming a character are written to
+// `next_pcs_`.  Quantifier iterations which match the empty string need not be
+// excluded here, since skipping them doesn't change which parts of the input
+// can match.
+bool ExperimentalRegExpDfa::RunBackwardClosure() {
+  bool is_match = false;
+  while (!threads_.empty()) {
+    const int pc = threads_.back().pc;
+    threads_.pop_back();
+    if (!Visit(pc, false)) continue;
+    if (pc == body_start_pc_) {
+      // The body of the regexp can start here.  Don't continue into the
+      // /.*?/ preamble, which would keep the pass going until the start of
+      // the input.
+      is_match = true;
+      continue;
+    }
+    if (pc > 0 && code_[pc - 1].opcode == RegExpInstruction::CONSUME_RANGE) {
+      next_pcs_.push_back(pc - 1);
+    }
+    for (int i = epsilon_predecessor_offsets_[pc];
+         i < epsilon_predecessor_offsets_[pc + 1]; ++i) {
+      threads_.push_back({epsilon_predecessors_[i], false});
+    }
+  }
+  // The order of PCs doesn't matter in backward states.
+  std::sort(next_pcs_.begin(), next_pcs_.end());
+  return is_match;
+}
+
+bool ExperimentalRegExpDfa::ComputeForwardState(int state, int char_class) {
+  const base::uc16 c = class_starts_[char_class];
+  NextStep();
+  threads_.clear();
+  next_pcs_.clear();
+  base::Vector<const int> pcs = forward_cache_.pcs(state);
+  // `threads_` is used as a stack, so the thread with highest priority is
+  // pushed last.
+  for (int i = pcs.length() - 1; i >= 0; --i) {
+    if (ConsumesAt(pcs[i], c)) threads_.push_back({pcs[i] + 1, true});
+  }
+  return RunForwardThreads();
+}
+
+bool ExperimentalRegExpDfa::ComputeBackwardState(int state, int char_class) {
+  const base::uc16 c = class_starts_[char_class];
+  NextStep();
+  threads_.clear();
+  next_pcs_.clear();
+  for (int pc : backward_cache_.pcs(state)) {
+    if (ConsumesAt(pc, c)) threads_.push_back({pc, false});
+  }
+  return RunBackwardClosure();
+}
+
+int ExperimentalRegExpDfa::AddState(StateCache* cache,
+                                    size_t* steps_since_clear, bool is_match,
+                                    int from_state, int char_class) {
+  int state = cache->Intern(base::VectorOf(next_pcs_), is_match);
+  if (state != StateCache::kCacheFull) {
+    if (from_state != StateCache::kUnknownState) {
+      cache->transition(from_state, char_class) = state;
+    }
+    return state;
+  }
+
+  if (*steps_since_clear <
+      kMinStepsPerStateBeforeClear * static_cast<size_t>(cache->size())) {
+    disabled_ = true;
+    return StateCache::kCacheFull;
+  }
+  // `from_state` doesn't survive clearing the cache, so its transition is not
+  // recorded.
+  cache->Clear();
+  *steps_since_clear = 0;
+  state = cache->Intern(base::VectorOf(next_pcs_), is_match);
+  // A single state can exceed the cache size for huge regexps.
+  if (state == StateCache::kCacheFull) disabled_ = true;
+  return state;
+}
+
+int ExperimentalRegExpDfa::ForwardStartState() {
+  if (forward_cache_.start_state() == StateCache::kUnknownState) {
+    NextStep();
+    threads_.clear();
+    next_pcs_.clear();
+    threads_.push_back({0, true});
+    const bool is_match = RunForwardThreads();
+    const int state =
+        AddState(&forward_cache_, &forward_steps_since_clear_, is_match,
+                 StateCache::kUnknownState, 0);
+    if (state == StateCache::kCacheFull) return state;
+    forward_cache_.set_start_state(state);
+  }
+  return forward_cache_.start_state();
+}
+
+int ExperimentalRegExpDfa::BackwardStartState() {
+  if (backward_cache_.start_state() == StateCache::kUnknownState) {
+    NextStep();
+    threads_.clear();
+    next_pcs_.clear();
+    threads_.push_back({accept_pc_, false});
+    const bool is_match = RunBackwardClosure();
+    const int state =
+        AddState(&backward_cache_, &backward_steps_since_clear_, is_match,
+                 StateCache::kUnknownState, 0);
+    if (state == StateCache::kCacheFull) return state;
+    backward_cache_.set_start_state(state);
+  }
+  return backward_cache_.start_state();
+}
+
+int ExperimentalRegExpDfa::NextForwardState(int state, int char_class) {
+  const int cached = forward_cache_.transition(state, char_class);
+  if (cached != StateCache::kUnknownState) return cached;
+
+  const bool is_match = ComputeForwardState(state, char_class);
+  return AddState(&forward_cache_, &forward_steps_since_clear_, is_match,
+                  state, char_class);
+}
+
+int ExperimentalRegExpDfa::NextBackwardState(int state, int char_class) {
+  const int cached = backward_cache_.transition(state, char_class);
+  if (cached != StateCache::kUnknownState) return cached;
+
+  const bool is_match = ComputeBackwardState(state, char_class);
+  return AddState(&backward_cache_, &backward_steps_since_clear_, is_match,
+                  state, char_class);
+}
+
+template <class Character>
+ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::FindMatch(
+    Isolate* isolate, base::Vector<const Character> input, int start_index,
+    int* match_begin, int* match_end) {
+  DCHECK_GE(start_index, 0);
+  DCHECK_LE(start_index, input.length());
+  if (disabled_) return Result::kFallback;
+
+  // Forward pass: Find where the match ends.  We can stop as soon as there
+  // are no threads left.
+  int state = ForwardStartState();
+  if (state == StateCache::kCacheFull) return Result::kFallback;
+  int end = forward_cache_.is_match(state) ? start_index : -1;
+  for (int i = start_index;
+       i != input.length() && !forward_cache_.is_dead(state); ++i) {
+    if ((i + 1) % kTicksBetweenInterruptChecks == 0 &&
+        InterruptRequested(isolate)) {
+      return Result::kFallback;
+    }
+    state = NextForwardState(state, CharacterClass(input[i]));
+    if (state == StateCache::kCacheFull) return Result::kFallback;
+    ++forward_steps_since_clear_;
+    if (forward_cache_.is_match(state)) end = i + 1;
+  }
+  if (end == -1) return Result::kNoMatch;
+
+  // Backward pass: Find the leftmost position from which the body matches
+  // up to `end`.
+  state = BackwardStartState();
+  if (state == StateCache::kCacheFull) return Result::kFallback;
+  int begin = backward_cache_.is_match(state) ? end : -1;
+  for (int i = end; i != start_index && !backward_cache_.is_dead(state); --i) {
+    if (i % kTicksBetweenInterruptChecks == 0 && InterruptRequested(isolate)) {
+      return Result::kFallback;
+    }
+    state = NextBackwardState(state, CharacterClass(input[i - 1]));
+    if (state == StateCache::kCacheFull) return Result::kFallback;
+    ++backward_steps_since_clear_;
+    if (backward_cache_.is_match(state)) begin = i - 1;
+  }
+  DCHECK_GE(begin, start_index);
+
+  *match_begin = begin;
+  *match_end = end;
+  return Result::kMatch;
+}
+
+template ExperimentalRegExpDfa::Result
+ExperimentalRegExpDfa::FindMatch<uint8_t>(Isolate* isolate,
+                                          base::Vector<const uint8_t> input,
+                                          int start_index, int* match_begin,
+                                          int* match_end);
+template ExperimentalRegExpDfa::Result
+ExperimentalRegExpDfa::FindMatch<base::uc16>(
+    Isolate* isolate, base::Vector<const base::uc16> input, int start_index,
+    int* match_begin, int* match_end);
+
+}  // namespace internal
+}  // namespace v8
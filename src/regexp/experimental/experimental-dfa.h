@@ -0,0 +1,187 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+// A lazily constructed deterministic automaton for experimental bytecode, in
+// the style of re2's DFA.  The DFA only computes the bounds of the match that
+// the NFA interpreter would report, not its capture registers, and is only
+// available for bytecode without assertions and lookbehinds.
+//
+// The bounds are found in two passes over the input:
+// - A forward pass simulates the NFA threads of the whole program, including
+//   the /.*?/ preamble of unanchored regexps.  A DFA state is the
+//   priority-ordered list of PCs of the blocked threads, together with whether
+//   a thread ACCEPTed when the state was entered.  As in the NFA interpreter,
+//   threads with lower priority than an ACCEPTing thread are discarded, so the
+//   last match seen by the forward pass ends where the NFA's match ends.
+// - The NFA match starts at the leftmost position from which the regexp body
+//   matches up to that end.  A backward pass from the end runs an automaton
+//   of the reversed body (without the preamble) and records the leftmost
+//   position at which the body could have started.
+//
+// DFA states and transitions are computed on demand and cached.  The cache is
+// bounded; when it fills up it is cleared, and if that happens too often the
+// DFA gives up and all further searches have to use the NFA.
+class ExperimentalRegExpDfa final : public ZoneObject {
+ public:
+  enum class Result { kNoMatch, kMatch, kFallback };
+
+  // Returns nullptr if `bytecode` contains instructions the DFA cannot
+  // simulate.
+  static ExperimentalRegExpDfa* TryCreate(
+      base::Vector<const RegExpInstruction> bytecode, Zone* zone);
+
+  // `code` has to end with the ACCEPT of the main expression.  Use `TryCreate`
+  // to check whether a bytecode program is supported.
+  ExperimentalRegExpDfa(base::Vector<const RegExpInstruction> code,
+                        int body_start_pc, Zone* zone);
+
+  // Searches `input` for a match starting at or after `start_index`.  Returns
+  // kMatch and sets `match_begin` and `match_end` if there is a match,
+  // kNoMatch if there is none, and kFallback if the search has to be done by
+  // the NFA interpreter instead, e.g. because an interrupt is pending.
+  template <class Character>
+  Result FindMatch(Isolate* isolate, base::Vector<const Character> input,
+                   int start_index, int* match_begin, int* match_end);
+
+ private:
+  // A thread of the forward pass.  `consumed` corresponds to
+  // `consumed_since_last_quantifier` of the NFA interpreter's threads.
+  struct Thread {
+    int pc;
+    bool consumed;
+  };
+
+  // Interned DFA states and their (partially computed) transitions.
+  class StateCache {
+   public:
+    static constexpr int kUnknownState = -1;
+    static constexpr int kCacheFull = -2;
+
+    StateCache(Zone* zone, int class_count);
+
+    // Returns the index of the state with the given PCs and match flag,
+    // adding it to the cache if necessary.  Returns kCacheFull if the state is
+    // new and there is no room for it.
+    int Intern(base::Vector<const int> pcs, bool is_match);
+    void Clear();
+
+    base::Vector<const int> pcs(int state) const {
+      const StateInfo& info = states_[state];
+      return base::Vector<const int>(pcs_.data() + info.pcs_begin,
+                                     info.pcs_length);
+    }
+    bool is_match(int state) const { return states_[state].is_match; }
+    bool is_dead(int state) const { return states_[state].pcs_length == 0; }
+    int& transition(int state, int char_class) {
+      return transitions_[state * class_count_ + char_class];
+    }
+    int size() const { return static_cast<int>(states_.size()); }
+
+    // The state in which a pass starts, kUnknownState if not yet computed.
+    int start_state() const { return start_state_; }
+    void set_start_state(int state) { start_state_ = state; }
+
+   private:
+    struct StateInfo {
+      int pcs_begin;
+      int pcs_length;
+      bool is_match;
+    };
+
+    size_t Hash(base::Vector<const int> pcs, bool is_match) const;
+    bool Equals(int state, base::Vector<const int> pcs, bool is_match) const;
+
+    const int class_count_;
+    const int max_states_;
+    ZoneVector<StateInfo> states_;
+    ZoneVector<int> pcs_;
+    ZoneVector<int> transitions_;
+    // Open addressing hash table of state indices, kUnknownState if empty.
+    ZoneVector<int> table_;
+    int start_state_ = kUnknownState;
+  };
+
+  template <class Character>
+  int CharacterClass(Character c) const;
+
+  // Return the state that `state` transitions to on characters of
+  // `char_class` in the respective pass, computing it if necessary.  May clear
+  // the cache, which invalidates all other state indices.  Return
+  // StateCache::kCacheFull if the DFA gives up.
+  int NextForwardState(int state, int char_class);
+  int NextBackwardState(int state, int char_class);
+
+  // Return the state in which the respective pass starts, or
+  // StateCache::kCacheFull if the DFA gives up.
+  int ForwardStartState();
+  int BackwardStartState();
+
+  // Compute the PCs of the state after a step of the respective pass in
+  // `next_pcs_`, and return whether the state matches.
+  bool ComputeForwardState(int state, int char_class);
+  bool ComputeBackwardState(int state, int char_class);
+  bool RunForwardThreads();
+  bool RunBackwardClosure();
+
+  // Adds the state described by `next_pcs_` to `cache` and records it as the
+  // transition of `from_state` on `char_class`, unless `from_state` is
+  // kUnknownState.  Clears the cache if it is full.  Returns
+  // StateCache::kCacheFull and disables the DFA if the cache has to be cleared
+  // too frequently to be of use.
+  int AddState(StateCache* cache, size_t* steps_since_clear, bool is_match,
+               int from_state, int char_class);
+
+  void NextStep() { ++step_; }
+  bool Visit(int pc, bool consumed);
+  bool ConsumesAt(int pc, base::uc16 c) const;
+
+  // The instructions up to and including the ACCEPT of the main expression.
+  base::Vector<const RegExpInstruction> code_;
+  // PC of the instruction that sets the match begin register.
+  const int body_start_pc_;
+  const int accept_pc_;
+
+  // Predecessors of each PC along edges that don't consume input, stored as
+  // `epsilon_predecessors_[epsilon_predecessor_offsets_[pc]...]`.
+  ZoneVector<int> epsilon_predecessor_offsets_;
+  ZoneVector<int> epsilon_predecessors_;
+
+  // Characters are grouped into classes that no CONSUME_RANGE distinguishes.
+  // `class_starts_[k]` is the smallest character of class k.
+  ZoneVector<base::uc16> class_starts_;
+  static constexpr int kLatin1ClassTableSize = 256;
+  ZoneVector<int> latin1_classes_;
+
+  StateCache forward_cache_;
+  StateCache backward_cache_;
+  // Characters processed since the respective cache was last cleared.
+  size_t forward_steps_since_clear_ = 0;
+  size_t backward_steps_since_clear_ = 0;
+  bool disabled_ = false;
+
+  // Scratch space for computing transitions.
+  ZoneVector<Thread> threads_;
+  ZoneVector<int> next_pcs_;
+  ZoneVector<uint32_t> visited_;
+  ZoneVector<uint32_t> blocked_;
+  uint32_t step_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
@@ -11,7 +11,9 @@
 #include "src/common/assert-scope.h"
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
+#include "src/objects/js-regexp.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -301,6 +303,7 @@ class NfaInterpreter {
         lookbehind_pc_(0, zone),
         filter_groups_pc_(std::nullopt),
         lookbehind_table_(0, zone),
+        dfa_(nullptr),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -357,6 +360,10 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_dfa) {
+      dfa_ = ExperimentalRegExpDfa::TryCreate(bytecode_, zone_);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -555,6 +562,32 @@ class NfaInterpreter {
       best_match_thread_ = std::nullopt;
     }
 
+    if (dfa_ != nullptr) {
+      int match_begin;
+      int match_end;
+      switch (dfa_->FindMatch(isolate_, input_, input_index_, &match_begin,
+                              &match_end)) {
+        case ExperimentalRegExpDfa::Result::kNoMatch:
+          return RegExp::kInternalRegExpSuccess;
+        case ExperimentalRegExpDfa::Result::kMatch:
+          if (register_count_per_match_ ==
+              JSRegExp::RegistersForCaptureCount(0)) {
+            // Without captures, the bounds are all we need.
+            best_match_thread_ = NewEmptyThread(0);
+            base::Vector<int> registers = GetRegisterArray(*best_match_thread_);
+            registers[0] = match_begin;
+            registers[1] = match_end;
+            return RegExp::kInternalRegExpSuccess;
+          }
+          // The DFA doesn't track capture registers, but the NFA only needs to
+          // look at the matched substring to compute them.
+          SetInputIndex(match_begin);
+          break;
+        case ExperimentalRegExpDfa::Result::kFallback:
+          break;
+      }
+    }
+
     // The lookbehind threads need to be executed before the thread of their
     // parent (lookbehind or main expression). The order of the bytecode (see
     // also `BytecodeAssembler`) ensures that they need to be executed from last
@@ -1091,6 +1124,10 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // Finds the bounds of matches faster than the NFA simulation.  Null if the
+  // bytecode is not supported by the DFA or the DFA is disabled.
+  ExperimentalRegExpDfa* dfa_;
+
   Zone* zone_;
 };
 
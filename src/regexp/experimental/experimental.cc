@@ -285,13 +285,44 @@ int32_t ExperimentalRegExp::OneshotExecRaw(
                    << regexp_data->source() << std::endl;
   }
 
+  Handle<TrustedByteArray> bytecode;
+  if (!OneshotCompile(isolate, regexp_data).ToHandle(&bytecode)) {
+    return RegExp::kInternalRegExpException;
+  }
+
+  DisallowGarbageCollection no_gc;
+  return ExecRawImpl(isolate, RegExp::kFromRuntime, *bytecode, *subject,
+                     regexp_data->capture_count(), output_registers,
+                     output_register_count, subject_index);
+}
+
+MaybeHandle<TrustedByteArray> ExperimentalRegExp::OneshotCompile(
+    Isolate* isolate, DirectHandle<IrRegExpData> regexp_data) {
+  DCHECK(v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
+
   std::optional<CompilationResult> compilation_result =
       CompileImpl(isolate, regexp_data);
-  if (!compilation_result.has_value()) return RegExp::kInternalRegExpException;
+  if (!compilation_result.has_value()) {
+    DCHECK(isolate->has_exception());
+    return MaybeHandle<TrustedByteArray>();
+  }
+  return compilation_result->bytecode;
+}
 
+int32_t ExperimentalRegExp::OneshotExecRaw(
+    Isolate* isolate, Tagged<IrRegExpData> regexp_data,
+    Tagged<TrustedByteArray> bytecode, Tagged<String> subject,
+    int32_t* output_registers, int32_t output_register_count,
+    int32_t subject_index) {
+  CHECK(v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
   DisallowGarbageCollection no_gc;
-  return ExecRawImpl(isolate, RegExp::kFromRuntime,
-                     *compilation_result->bytecode, *subject,
+
+  if (v8_flags.trace_experimental_regexp_engine) {
+    StdoutStream{} << "Experimental execution (oneshot, precompiled) of regexp "
+                   << regexp_data->source() << std::endl;
+  }
+
+  return ExecRawImpl(isolate, RegExp::kFromRuntime, bytecode, subject,
                      regexp_data->capture_count(), output_registers,
                      output_register_count, subject_index);
 }
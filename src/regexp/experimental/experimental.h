@@ -60,6 +60,19 @@ class ExperimentalRegExp final : public AllStatic {
                                 int32_t output_register_count,
                                 int32_t subject_index);
 
+  // Compile a regexp with the experimental engine like OneshotExec does, and
+  // return the bytecode so that callers which execute the regexp repeatedly,
+  // e.g. for all matches of a global regexp, only compile it once.
+  static MaybeHandle<TrustedByteArray> OneshotCompile(
+      Isolate* isolate, DirectHandle<IrRegExpData> regexp_data);
+  static int32_t OneshotExecRaw(Isolate* isolate,
+                                Tagged<IrRegExpData> regexp_data,
+                                Tagged<TrustedByteArray> bytecode,
+                                Tagged<String> subject,
+                                int32_t* output_registers,
+                                int32_t output_register_count,
+                                int32_t subject_index);
+
   static constexpr bool kSupportsUnicode = false;
 };
 
@@ -3030,13 +3030,18 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
   int lookahead_width = max_lookahead + 1 - min_lookahead;
 
-  if (found_single_character && lookahead_width == 1 && max_lookahead < 3) {
+  // The vectorized table lookup below scans a whole vector of characters per
+  // iteration, which beats both the mask-compare and the scalar loop for a
+  // single character, so only use those if SIMD is not available.
+  const bool use_simd = masm->SkipUntilBitInTableUseSimd(lookahead_width);
+
+  if (found_single_character && lookahead_width == 1 && max_lookahead < 3 &&
+      !use_simd) {
     // The mask-compare can probably handle this better.
     return;
   }
 
-  if (found_single_character) {
-    // TODO(pthier): Add vectorized version.
+  if (found_single_character && !use_simd) {
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -3056,8 +3061,8 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   Handle<ByteArray> boolean_skip_table =
       factory->NewByteArray(kSize, AllocationType::kOld);
   Handle<ByteArray> nibble_table;
-  const int skip_distance = max_lookahead + 1 - min_lookahead;
-  if (masm->SkipUntilBitInTableUseSimd(skip_distance)) {
+  const int skip_distance = lookahead_width;
+  if (use_simd) {
     // The current implementation is tailored specifically for 128-bit tables.
     static_assert(kSize == 128);
     nibble_table =
@@ -1169,11 +1169,24 @@ int32_t* RegExpGlobalCache::FetchNext() {
       }
     }
 
-    // Fall back to experimental engine if needed and possible.
+    // Fall back to experimental engine if needed and possible.  The bytecode
+    // is compiled on the first fallback and reused by later batches that also
+    // backtrack excessively. Every batch tries irregexp first, since most
+    // matches of a global regexp may not need the fallback at all.
     if (num_matches_ == RegExp::kInternalRegExpFallbackToExperimental) {
-      num_matches_ = ExperimentalRegExp::OneshotExecRaw(
-          isolate_, Cast<IrRegExpData>(regexp_data_), subject_, register_array_,
-          register_array_size_, last_end_index);
+      if (experimental_fallback_bytecode_.is_null() &&
+          !ExperimentalRegExp::OneshotCompile(
+               isolate_, Cast<IrRegExpData>(regexp_data_))
+               .ToHandle(&experimental_fallback_bytecode_)) {
+        DCHECK(isolate_->has_exception());
+        num_matches_ = RegExp::kInternalRegExpException;
+      } else {
+        DisallowGarbageCollection no_gc;
+        num_matches_ = ExperimentalRegExp::OneshotExecRaw(
+            isolate_, Cast<IrRegExpData>(*regexp_data_),
+            *experimental_fallback_bytecode_, *subject_, register_array_,
+            register_array_size_, last_end_index);
+      }
     }
 
     if (num_matches_ <= 0) {
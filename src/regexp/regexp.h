@@ -206,6 +206,10 @@ class RegExpGlobalCache final {
   int register_array_size_;
   Handle<RegExpData> regexp_data_;
   Handle<String> subject_;
+  // Experimental engine bytecode, set once an irregexp regexp has fallen back
+  // to the experimental engine due to excessive backtracking, and reused for
+  // later fallbacks.
+  Handle<TrustedByteArray> experimental_fallback_bytecode_;
   Isolate* isolate_;
 };
 
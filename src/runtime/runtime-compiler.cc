@@ -14,6 +14,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/shared-function-info.h"
@@ -363,6 +364,36 @@ void DeoptAllOsrLoopsContainingDeoptExit(Isolate* isolate,
   }
 }
 
+// Reports a deoptimization to the embedder's metrics recorder, if one is
+// installed.
+void RecordJSFunctionDeoptimizedEvent(Isolate* isolate,
+                                      DirectHandle<JSFunction> function,
+                                      DirectHandle<Code> optimized_code,
+                                      DeoptimizeKind deopt_kind,
+                                      DeoptimizeReason deopt_reason,
+                                      BytecodeOffset deopt_exit_offset) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  v8::metrics::JSFunctionDeoptimized event;
+  if (IsScript(shared->script())) {
+    event.script_id = Cast<Script>(shared->script())->id();
+  }
+  event.function_start_position = shared->StartPosition();
+  event.tier = optimized_code->kind() == CodeKind::MAGLEV
+                   ? v8::metrics::OptimizedTier::kMaglev
+                   : v8::metrics::OptimizedTier::kTurbofan;
+  event.osr = !optimized_code->osr_offset().IsNone();
+  event.lazy = deopt_kind == DeoptimizeKind::kLazy;
+  event.reason = DeoptimizeReasonToString(deopt_reason);
+  event.bytecode_offset = deopt_exit_offset.ToInt();
+  DirectHandle<NativeContext> native_context(function->native_context(),
+                                             isolate);
+  recorder->DelayMainThreadEvent(
+      event, isolate->GetOrRegisterRecorderContextId(native_context));
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
@@ -398,6 +429,9 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Cast<Context>(top_frame->context()));
 
+  RecordJSFunctionDeoptimizedEvent(isolate, function, optimized_code,
+                                   deopt_kind, deopt_reason, deopt_exit_offset);
+
   // Lazy deopts don't invalidate the underlying optimized code since the code
   // object itself is still valid (as far as we know); the called function
   // caused the deopt, not the function we're currently looking at.
@@ -561,6 +561,24 @@ RUNTIME_FUNCTION(Runtime_WasmNumCodeSpaces) {
   return *isolate->factory()->NewNumberFromSize(num_spaces);
 }
 
+// Moves live code of the instance's module into code space freed by the wasm
+// code GC, like the task scheduled after a code GC does, and returns the total
+// number of code objects relocated for the module so far.
+RUNTIME_FUNCTION(Runtime_WasmCompactCode) {
+  HandleScope scope(isolate);
+  if (args.length() != 1 || !IsWasmInstanceObject(args[0]) ||
+      !v8_flags.wasm_code_compaction) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  wasm::NativeModule* native_module =
+      Cast<WasmInstanceObject>(args[0])->trusted_data(isolate)->native_module();
+  wasm::WasmCodeRefScope code_ref_scope;
+  std::vector<wasm::WasmCode*> relocated_code = native_module->CompactCode();
+  wasm::GetWasmEngine()->LogCode(base::VectorOf(relocated_code));
+  return *isolate->factory()->NewNumberFromSize(
+      native_module->GetNumberOfRelocatedCodeForTesting());
+}
+
 namespace {
 
 template <typename T1, typename T2 = T1>
@@ -728,6 +728,7 @@ namespace internal {
   F(SetWasmCompileControls, 2, 1)                          \
   F(SetWasmImportedStringsEnabled, 1, 1)                   \
   F(SetWasmInstantiateControls, 0, 1)                      \
+  F(WasmCompactCode, 1, 1)                                 \
   F(WasmCompiledExportWrappersCount, 0, 1)                 \
   F(WasmDeoptsExecutedCount, 0, 1)                         \
   F(WasmDeoptsExecutedForFunction, 1, 1)                   \
@@ -178,7 +178,11 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
               debug_info->OriginalBytecodeArray(isolate()), isolate());
         }
       }
-      if (v8_flags.profile_guided_optimization) {
+      // Unless requested otherwise, only persist decisions up to early
+      // Sparkplug compilation; decisions for the optimizing tiers depend on
+      // feedback that is not part of the cache.
+      if (v8_flags.profile_guided_optimization &&
+          !v8_flags.code_cache_tiering_decisions) {
         cached_tiering_decision = sfi->cached_tiering_decision();
         if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
           sfi->set_cached_tiering_decision(
@@ -194,6 +198,7 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                   isolate());
     }
     if (v8_flags.profile_guided_optimization &&
+        !v8_flags.code_cache_tiering_decisions &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
     }
@@ -651,6 +651,26 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLocalsForLoop() {
+  int kept_registers[2] = {0, 0};
+  for (VarState& local_slot :
+       base::VectorOf(cache_state_.stack_state.data(), num_locals_)) {
+    if (local_slot.is_reg()) {
+      RegClass rc = reg_class_for(local_slot.kind());
+      // Register pairs and registers with other uses (which would need to be
+      // split at each merge) are spilled.
+      if ((rc == kGpReg || rc == kFpReg) &&
+          cache_state_.get_use_count(local_slot.reg()) == 1 &&
+          2 * (kept_registers[rc] + 1) <=
+              GetCacheRegList(rc).GetNumRegsSet()) {
+        ++kept_registers[rc];
+        continue;
+      }
+    }
+    Spill(&local_slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (VarState& slot : cache_state_.stack_state) {
     if (!slot.is_reg()) continue;
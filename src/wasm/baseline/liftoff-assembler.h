@@ -564,6 +564,10 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Like {SpillLocals}, but keeps locals in their registers if each register
+  // holds only that local and at most half of the cache registers of a class
+  // are kept. Used at loop headers, so back edges do not reload all locals.
+  void SpillLocalsForLoop();
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
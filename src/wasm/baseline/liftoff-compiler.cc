@@ -1407,9 +1407,16 @@ class LiftoffCompiler {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
     // into registers at branches.
+    // With --liftoff-loop-locals-in-registers, locals which are already in
+    // registers stay there (within limits), so that the loop body and the
+    // back edge do not need to reload them from the stack.
     // TODO(clemensb): Come up with a better strategy here, involving
     // pre-analysis of the function.
-    __ SpillLocals();
+    if (v8_flags.liftoff_loop_locals_in_registers && !for_debugging_) {
+      __ SpillLocalsForLoop();
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -2184,7 +2191,6 @@ class LiftoffCompiler {
       CASE_TYPE_CONVERSION(I32UConvertF64, I32, F64, nullptr, kCanTrap)
       CASE_TYPE_CONVERSION(I32ReinterpretF32, I32, F32, nullptr, kNoTrap)
       CASE_TYPE_CONVERSION(I64SConvertI32, I64, I32, nullptr, kNoTrap)
-      CASE_TYPE_CONVERSION(I64UConvertI32, I64, I32, nullptr, kNoTrap)
       CASE_TYPE_CONVERSION(I64SConvertF32, I64, F32,
                            &ExternalReference::wasm_float32_to_int64, kCanTrap)
       CASE_TYPE_CONVERSION(I64UConvertF32, I64, F32,
@@ -2233,6 +2239,12 @@ class LiftoffCompiler {
       CASE_TYPE_CONVERSION(I64UConvertSatF64, I64, F64,
                            &ExternalReference::wasm_float64_to_uint64_sat,
                            kNoTrap)
+      case kExprI64UConvertI32:
+        // Remember where the zero-extension ends, so that a memory64 load
+        // directly using it as index can skip the guard region check.
+        zero_extended_i32_end_pc_ = decoder->pc() + 1;
+        return EmitTypeConversion<kI64, kI32, kNoTrap>(
+            decoder, kExprI64UConvertI32, nullptr);
       case kExprI32Eqz:
         DCHECK(decoder->lookahead(0, kExprI32Eqz));
         if ((decoder->lookahead(1, kExprBrIf) ||
@@ -3360,6 +3372,17 @@ class LiftoffCompiler {
     kCheckAlignment = true,
     kDontCheckAlignment = false
   };
+  enum ZeroExtendedIndex : bool {
+    kZeroExtendedIndex = true,
+    kFullIndex = false
+  };
+
+  // Returns whether the i64 index on top of the value stack was produced by
+  // an i64.extend_i32_u immediately preceding the current instruction.
+  ZeroExtendedIndex IndexOnTopIsZeroExtended(FullDecoder* decoder) const {
+    return decoder->pc() == zero_extended_i32_end_pc_ ? kZeroExtendedIndex
+                                                      : kFullIndex;
+  }
 
   // Returns the GP {index} register holding the ptrsized index.
   // Note that the {index} will typically not be pinned, but the returned
@@ -3369,7 +3392,8 @@ class LiftoffCompiler {
                           uint32_t access_size, uint64_t offset,
                           LiftoffRegister index, LiftoffRegList pinned,
                           ForceCheck force_check,
-                          AlignmentCheck check_alignment) {
+                          AlignmentCheck check_alignment,
+                          ZeroExtendedIndex zero_extended_index = kFullIndex) {
     // The decoder ensures that the access is not statically OOB.
     DCHECK(base::IsInBounds<uintptr_t>(offset, access_size,
                                        memory->max_memory_size));
@@ -3399,7 +3423,11 @@ class LiftoffCompiler {
     DCHECK_IMPLIES(memory->is_memory64 && !v8_flags.wasm_memory64_trap_handling,
                    bounds_checks == kExplicitBoundsChecks);
     if (!force_check && bounds_checks == kTrapHandler) {
-      if (memory->is_memory64) {
+      // A zero-extended i32 index is always within the guard regions if
+      // they cover the full 32-bit range.
+      if (memory->is_memory64 &&
+          !(zero_extended_index &&
+            memory->GetMemory64GuardsSize() > kMaxUInt32)) {
         SCOPED_CODE_COMMENT("bounds check memory");
         // If index is outside the guards pages, sets index to a value that will
         // certainly cause (memory_start + offset + index) to be not accessible,
@@ -3677,10 +3705,11 @@ class LiftoffCompiler {
         __ PushRegister(kind, value);
       }
     } else {
+      ZeroExtendedIndex zero_extended_index = IndexOnTopIsZeroExtended(decoder);
       LiftoffRegister full_index = __ PopToRegister();
-      index =
-          BoundsCheckMem(decoder, imm.memory, type.size(), offset, full_index,
-                         {}, kDontForceCheck, kDontCheckAlignment);
+      index = BoundsCheckMem(decoder, imm.memory, type.size(), offset,
+                             full_index, {}, kDontForceCheck,
+                             kDontCheckAlignment, zero_extended_index);
 
       SCOPED_CODE_COMMENT("load from memory");
       LiftoffRegList pinned{index};
@@ -3721,15 +3750,16 @@ class LiftoffCompiler {
                      Value* result) {
     CHECK(CheckSupportedType(decoder, kS128, "LoadTransform"));
 
+    ZeroExtendedIndex zero_extended_index = IndexOnTopIsZeroExtended(decoder);
     LiftoffRegister full_index = __ PopToRegister();
     // For load splats and load zero, LoadType is the size of the load, and for
     // load extends, LoadType is the size of the lane, and it always loads 8
     // bytes.
     uint32_t access_size =
         transform == LoadTransformationKind::kExtend ? 8 : type.size();
-    Register index =
-        BoundsCheckMem(decoder, imm.memory, access_size, imm.offset, full_index,
-                       {}, kDontForceCheck, kDontCheckAlignment);
+    Register index = BoundsCheckMem(decoder, imm.memory, access_size,
+                                    imm.offset, full_index, {}, kDontForceCheck,
+                                    kDontCheckAlignment, zero_extended_index);
 
     uintptr_t offset = imm.offset;
     LiftoffRegList pinned{index};
@@ -9228,6 +9258,9 @@ class LiftoffCompiler {
   // Set by the first opcode, reset by the second.
   WasmOpcode outstanding_op_ = kNoOutstandingOp;
 
+  // End of the last i64.extend_i32_u, see {IndexOnTopIsZeroExtended}.
+  const uint8_t* zero_extended_i32_end_pc_ = nullptr;
+
   // {supported_types_} is updated in {MaybeBailoutForUnsupportedType}.
   base::EnumSet<ValueKind> supported_types_ = kUnconditionallySupported;
   compiler::CallDescriptor* const descriptor_;
@@ -6384,14 +6384,20 @@ size_t WasmBytecodeGenerator::Simd128Hash::operator()(
 // Look if the slot that hold the value at {stack_index} is being shared with
 // other slots. This can happen if there are multiple load.get operations that
 // copy from the same local.
-bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index) const {
+bool WasmBytecodeGenerator::HasSharedSlot(
+    uint32_t stack_index, uint32_t ignored_top_entries) const {
   // Only consider stack entries added in the current block.
   // We don't need to consider ancestor blocks because if a block has a
   // non-empty signature we always pass arguments and results into separate
   // slots, emitting CopySlot operations.
+  // The {ignored_top_entries} topmost entries are about to be consumed by the
+  // instruction being encoded, so they do not need to be preserved.
   uint32_t start_slot_index = blocks_[current_block_index_].stack_size_;
+  DCHECK_LE(ignored_top_entries, stack_.size());
+  uint32_t end_slot_index =
+      static_cast<uint32_t>(stack_.size()) - ignored_top_entries;
 
-  for (uint32_t i = start_slot_index; i < stack_.size(); i++) {
+  for (uint32_t i = start_slot_index; i < end_slot_index; i++) {
     if (stack_[i] == stack_[stack_index]) {
       return true;
     }
@@ -11140,6 +11146,40 @@ bool WasmBytecodeGenerator::EncodeSuperInstruction(
         reg_mode = RegMode::kNoReg;
         return true;
       }
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprLocalSet &&
+             (reg_mode == RegMode::kNoReg ||
+              reg_mode == curr_instr.InputRegMode())) {
+    // Write the result of a binary operation directly into the local slot,
+    // saving the dispatch of the local.set. The operands are read before the
+    // result is written, so they may alias the local. Any other stack entry
+    // that still refers to the local slot must keep the old value, though.
+    uint32_t to_stack_index = next_instr.optional.index;
+    const uint32_t operands_on_stack = reg_mode == RegMode::kNoReg ? 2 : 1;
+    switch (curr_instr.orig) {
+// The s2s and r2s binop handlers pop their stack operands and then store the
+// result into the slot whose offset follows in the bytecode, so they can be
+// reused with the local's slot offset.
+#define BINOP_LOCAL_SET_CASE(name, ctype, reg, op, type)                \
+  case kExpr##name: {                                                   \
+    if (HasSharedSlot(to_stack_index, operands_on_stack)) return false; \
+    if (reg_mode == RegMode::kNoReg) {                                  \
+      EMIT_INSTR_HANDLER(s2s_##name);                                   \
+      type##Pop();                                                      \
+      type##Pop();                                                      \
+    } else {                                                            \
+      EMIT_INSTR_HANDLER(r2s_##name);                                   \
+      type##Pop();                                                      \
+    }                                                                   \
+    EmitI32Const(slots_[stack_[to_stack_index]].slot_offset);           \
+    reg_mode = RegMode::kNoReg;                                         \
+    return true;                                                        \
+  }
+      FOREACH_ARITHMETIC_BINOP(BINOP_LOCAL_SET_CASE)
+#undef BINOP_LOCAL_SET_CASE
+
       default:
         return false;
     }
@@ -1201,6 +1201,21 @@ bool CompileLazy(Isolate* isolate,
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  // If deserialization of this function was deferred, copy its TurboFan code
+  // now instead of compiling it.
+  if (v8_flags.wasm_lazy_deserialization && !is_in_debug_state) {
+    WasmCodeRefScope code_ref_scope;
+    if (WasmCode* code = MaterializeDeferredCode(native_module, func_index)) {
+      DCHECK_EQ(func_index, code->index());
+      if (V8_UNLIKELY(native_module->log_code())) {
+        GetWasmEngine()->LogCode(base::VectorOf(&code, 1));
+        GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+      }
+      return true;
+    }
+  }
+
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -3359,10 +3374,19 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
   // Set outstanding_finishers_ to 2, because both the AsyncCompileJob and the
   // AsyncStreamingProcessor have to finish.
   job_->outstanding_finishers_.store(2);
-  // TODO(13209): Use PGO for streaming compilation, if available.
-  constexpr ProfileInformation* kNoProfileInformation = nullptr;
+  // The full profile is keyed by the hash of all wire bytes and is applied in
+  // {FinishCompile}. With --experimental-wasm-pgo-streaming, tiering data keyed
+  // by the prefix hash is applied now, so functions that tiered up in the
+  // profiling run get their TurboFan units scheduled as soon as their bodies
+  // arrive.
+  // TODO(13209): Use PGO for streaming compilation in production.
+  std::unique_ptr<ProfileInformation> pgo_info;
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_streaming)) {
+    pgo_info =
+        LoadTieringProfileForPrefixFromFile(decoder_.module(), prefix_hash_);
+  }
   compilation_unit_builder_ = InitializeCompilation(
-      job_->isolate(), job_->native_module_.get(), kNoProfileInformation);
+      job_->isolate(), job_->native_module_.get(), pgo_info.get());
   return true;
 }
 
@@ -3687,8 +3711,35 @@ void CompilationStateImpl::ApplyCompilationHintToInitialProgress(
                                  (old_baseline_tier != ExecutionTier::kNone);
 }
 
+namespace {
+// Functions that were executed but not tiered up in the profiling run resume
+// with the tiering budget they had left, so warm functions reach TurboFan
+// sooner.
+void ApplyPgoBudgets(NativeModule* native_module,
+                     ProfileInformation* pgo_info) {
+  base::Vector<const uint32_t> consumed_budgets = pgo_info->consumed_budgets();
+  if (consumed_budgets.empty()) return;
+  DCHECK_EQ(native_module->module()->num_declared_functions,
+            consumed_budgets.size());
+  const uint32_t initial_budget = v8_flags.wasm_tiering_budget;
+  std::atomic<uint32_t>* budgets = native_module->tiering_budget_array();
+  for (size_t i = 0; i < consumed_budgets.size(); ++i) {
+    if (consumed_budgets[i] == 0) continue;
+    uint32_t remaining = initial_budget > consumed_budgets[i]
+                             ? initial_budget - consumed_budgets[i]
+                             : 1;
+    uint32_t current = budgets[i].load(std::memory_order_relaxed);
+    if (remaining < current) {
+      budgets[i].store(remaining, std::memory_order_relaxed);
+    }
+  }
+}
+}  // namespace
+
 void CompilationStateImpl::ApplyPgoInfoToInitialProgress(
     ProfileInformation* pgo_info) {
+  ApplyPgoBudgets(native_module_, pgo_info);
+
   // Functions that were executed in the profiling run are eagerly compiled to
   // Liftoff.
   const WasmModule* module = native_module_->module();
@@ -3729,6 +3780,7 @@ void CompilationStateImpl::ApplyPgoInfoToInitialProgress(
 
 void CompilationStateImpl::ApplyPgoInfoLate(ProfileInformation* pgo_info) {
   TRACE_EVENT0("v8.wasm", "wasm.ApplyPgoInfo");
+  ApplyPgoBudgets(native_module_, pgo_info);
   const WasmModule* module = native_module_->module();
   CompilationUnitBuilder builder{native_module_};
 
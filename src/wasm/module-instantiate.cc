@@ -310,8 +310,12 @@ bool IsSupportedWasmFastApiFunction(Isolate* isolate,
   return false;
 }
 
+// Returns whether {callable} can be called through the Fast API wrapper with
+// {expected_sig}. On success, {out_api_function_index} is set to the C function
+// overload that matches the signature.
 bool ResolveBoundJSFastApiFunction(const wasm::FunctionSig* expected_sig,
-                                   DirectHandle<JSReceiver> callable) {
+                                   DirectHandle<JSReceiver> callable,
+                                   int* out_api_function_index) {
   DirectHandle<JSFunction> target;
   if (IsJSBoundFunction(*callable)) {
     auto bound_target = Cast<JSBoundFunction>(callable);
@@ -336,14 +340,9 @@ bool ResolveBoundJSFastApiFunction(const wasm::FunctionSig* expected_sig,
 
   Isolate* isolate = target->GetIsolate();
   DirectHandle<SharedFunctionInfo> shared(target->shared(), isolate);
-  int api_function_index = -1;
-  // The fast API call wrapper currently does not support function overloading.
-  // Therefore, if the matching function is not function 0, the fast API cannot
-  // be used.
   return IsSupportedWasmFastApiFunction(isolate, expected_sig, *shared,
                                         ReceiverKind::kAnyReceiver,
-                                        &api_function_index) &&
-         api_function_index == 0;
+                                        out_api_function_index);
 }
 
 bool IsStringRef(wasm::ValueType type) {
@@ -753,8 +752,10 @@ ImportCallKind ResolvedWasmImport::ComputeKind(
     return ImportCallKind::kRuntimeTypeError;
   }
   // Check if this can be a JS fast API call.
+  int api_function_index = -1;
   if (v8_flags.turbo_fast_api_calls &&
-      ResolveBoundJSFastApiFunction(expected_sig, callable_)) {
+      ResolveBoundJSFastApiFunction(expected_sig, callable_,
+                                    &api_function_index)) {
     return ImportCallKind::kWasmToJSFastApi;
   }
   well_known_status_ = CheckForWellKnownImport(
@@ -1956,8 +1957,11 @@ bool InstanceBuilder::ProcessImportedFunction(
       // So the {CacheKey} is a dummy, and we don't look for an existing
       // wrapper. Key collisions are not a concern because lifetimes are
       // determined by refcounting.
+      int api_function_index = -1;
+      CHECK(ResolveBoundJSFastApiFunction(expected_sig, js_receiver,
+                                          &api_function_index));
       WasmCompilationResult result = compiler::CompileWasmJSFastCallWrapper(
-          native_module, expected_sig, js_receiver);
+          native_module, expected_sig, js_receiver, api_function_index);
       WasmCode* wasm_code;
       {
         WasmImportWrapperCache::ModificationScope cache_scope(
@@ -2007,38 +2011,9 @@ bool InstanceBuilder::ProcessImportedFunction(
         // generic wrapper will be used (see above).
         NativeModule* native_module = trusted_instance_data->native_module();
         bool source_positions = is_asmjs_module(native_module->module());
-        CompilationEnv env = CompilationEnv::ForModule(native_module);
-        WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
-            &env, kind, expected_sig, source_positions, expected_arity,
-            resolved.suspend());
-        bool code_is_new = false;
-        {
-          WasmImportWrapperCache::ModificationScope cache_scope(cache);
-          WasmImportWrapperCache::CacheKey key(
-              kind, canonical_sig_id, expected_arity, resolved.suspend());
-          // Now that we have the lock (in the form of the cache_scope), check
-          // again whether another thread has just created the wrapper.
-          wasm_code = cache_scope[key];
-          if (!wasm_code) {
-            wasm_code = cache_scope.AddWrapper(
-                key, std::move(result), WasmCode::Kind::kWasmToJsWrapper);
-            code_is_new = true;
-          }
-        }
-        if (code_is_new) {
-          // To avoid lock order inversion, code printing must happen after the
-          // end of the {cache_scope}.
-          wasm_code->MaybePrint();
-          isolate_->counters()->wasm_generated_code_size()->Increment(
-              wasm_code->instructions().length());
-          isolate_->counters()->wasm_reloc_size()->Increment(
-              wasm_code->reloc_info().length());
-          if (V8_UNLIKELY(native_module->log_code())) {
-            GetWasmEngine()->LogWrapperCode(base::VectorOf(&wasm_code, 1));
-            // Log the code immediately in the current isolate.
-            GetWasmEngine()->LogOutstandingCodesForIsolate(isolate_);
-          }
-        }
+        wasm_code = cache->CompileWasmImportCallWrapper(
+            isolate_, native_module, kind, expected_sig, canonical_sig_id,
+            source_positions, expected_arity, resolved.suspend());
       }
 
       DCHECK_NOT_NULL(wasm_code);
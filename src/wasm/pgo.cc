@@ -4,7 +4,10 @@
 
 #include "src/wasm/pgo.h"
 
+#include <algorithm>
+
 #include "src/wasm/decoder.h"
+#include "src/wasm/wasm-engine.h"          // For {NativeModuleCache}.
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
 namespace v8::internal::wasm {
@@ -12,6 +15,16 @@ namespace v8::internal::wasm {
 constexpr uint8_t kFunctionExecutedBit = 1 << 0;
 constexpr uint8_t kFunctionTieredUpBit = 1 << 1;
 
+// The budget is decremented by generated code without a lower bound, so it can
+// drop below zero, and it is not reset if the budget flag changes after the
+// module was created. Clamp the consumed budget to [0, initial budget].
+uint32_t ConsumedBudget(uint32_t initial_budget, uint32_t remaining_budget) {
+  int64_t consumed = int64_t{initial_budget} -
+                     int64_t{static_cast<int32_t>(remaining_budget)};
+  return static_cast<uint32_t>(
+      std::clamp<int64_t>(consumed, 0, int64_t{initial_budget}));
+}
+
 class ProfileGenerator {
  public:
   ProfileGenerator(const WasmModule* module,
@@ -25,6 +38,19 @@ class ProfileGenerator {
 
     SerializeTypeFeedback(buffer);
     SerializeTieringInfo(buffer);
+    SerializeExecutionBudgets(buffer);
+
+    return base::OwnedVector<uint8_t>::Of(buffer);
+  }
+
+  // Only the tiering part of the profile. Type feedback refers to call sites
+  // within function bodies, so it is left out of data that is looked up
+  // before the code section is known.
+  base::OwnedVector<uint8_t> GetTieringData() {
+    ZoneBuffer buffer{&zone_};
+
+    SerializeTieringInfo(buffer);
+    SerializeExecutionBudgets(buffer);
 
     return base::OwnedVector<uint8_t>::Of(buffer);
   }
@@ -83,7 +109,6 @@ class ProfileGenerator {
       DCHECK_LE(0, prio);
       uint32_t remaining_budget =
           tiering_budget_array_[declared_index].load(std::memory_order_relaxed);
-      DCHECK_GE(initial_budget, remaining_budget);
 
       bool was_tiered_up = prio > 0;
       bool was_executed = was_tiered_up || remaining_budget != initial_budget;
@@ -94,6 +119,26 @@ class ProfileGenerator {
     }
   }
 
+  // Per declared function, the consumed tiering budget and the tier-up
+  // priority. Older profiles end before this section.
+  void SerializeExecutionBudgets(ZoneBuffer& buffer) {
+    const std::unordered_map<uint32_t, FunctionTypeFeedback>&
+        feedback_for_function = module_->type_feedback.feedback_for_function;
+    const uint32_t initial_budget = v8_flags.wasm_tiering_budget;
+    for (uint32_t declared_index = 0;
+         declared_index < module_->num_declared_functions; ++declared_index) {
+      uint32_t func_index = declared_index + module_->num_imported_functions;
+      auto feedback_it = feedback_for_function.find(func_index);
+      int prio = feedback_it == feedback_for_function.end()
+                     ? 0
+                     : feedback_it->second.tierup_priority;
+      uint32_t remaining_budget =
+          tiering_budget_array_[declared_index].load(std::memory_order_relaxed);
+      buffer.write_u32v(ConsumedBudget(initial_budget, remaining_budget));
+      buffer.write_u32v(static_cast<uint32_t>(prio));
+    }
+  }
+
  private:
   const WasmModule* module_;
   AccountingAllocator allocator_;
@@ -173,8 +218,25 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
     if (was_executed) executed_functions.push_back(func_index);
   }
 
+  std::vector<uint32_t> consumed_budgets;
+  if (decoder.more()) {
+    std::vector<uint32_t> priorities(module->num_declared_functions);
+    consumed_budgets.resize(module->num_declared_functions);
+    for (uint32_t i = 0; i < module->num_declared_functions; ++i) {
+      consumed_budgets[i] = decoder.consume_u32v("consumed budget");
+      priorities[i] = decoder.consume_u32v("tier-up priority");
+    }
+    // Schedule the hottest functions first when compiling TurboFan code
+    // eagerly.
+    std::stable_sort(tiered_up_functions.begin(), tiered_up_functions.end(),
+                     [&](uint32_t a, uint32_t b) {
+                       return priorities[a - start] > priorities[b - start];
+                     });
+  }
+
   return std::make_unique<ProfileInformation>(std::move(executed_functions),
-                                              std::move(tiered_up_functions));
+                                              std::move(tiered_up_functions),
+                                              std::move(consumed_budgets));
 }
 
 std::unique_ptr<ProfileInformation> RestoreProfileData(
@@ -191,6 +253,38 @@ std::unique_ptr<ProfileInformation> RestoreProfileData(
   return pgo_info;
 }
 
+void WriteProfileFile(const char* filename,
+                      base::Vector<const uint8_t> profile_data) {
+  if (FILE* file = base::OS::FOpen(filename, "wb")) {
+    size_t written = fwrite(profile_data.begin(), 1, profile_data.size(), file);
+    CHECK_EQ(profile_data.size(), written);
+    base::Fclose(file);
+  }
+}
+
+base::OwnedVector<uint8_t> ReadProfileFile(const char* filename) {
+  FILE* file = base::OS::FOpen(filename, "rb");
+  if (!file) {
+    PrintF("No Wasm PGO data found: Cannot open file '%s'\n", filename);
+    return {};
+  }
+
+  fseek(file, 0, SEEK_END);
+  size_t size = ftell(file);
+  rewind(file);
+
+  PrintF("Loading Wasm PGO data from file '%s' (%zu bytes)\n", filename, size);
+  base::OwnedVector<uint8_t> profile_data =
+      base::OwnedVector<uint8_t>::NewForOverwrite(size);
+  for (size_t read = 0; read < size;) {
+    read += fread(profile_data.begin() + read, 1, size - read, file);
+    CHECK(!ferror(file));
+  }
+
+  base::Fclose(file);
+  return profile_data;
+}
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array) {
@@ -210,10 +304,20 @@ void DumpProfileToFile(const WasmModule* module,
       "functions, %zu bytes PGO data)\n",
       filename.begin(), wire_bytes.size(), module->num_declared_functions,
       profile_data.size());
-  if (FILE* file = base::OS::FOpen(filename.begin(), "wb")) {
-    size_t written = fwrite(profile_data.begin(), 1, profile_data.size(), file);
-    CHECK_EQ(profile_data.size(), written);
-    base::Fclose(file);
+  WriteProfileFile(filename.begin(), profile_data.as_vector());
+
+  if (v8_flags.experimental_wasm_pgo_streaming) {
+    // Streaming compilation only knows the module prefix (everything before
+    // the code section) when it sets up compilation, so also store the tiering
+    // data under the prefix hash used by the {NativeModuleCache}.
+    uint32_t prefix_hash =
+        static_cast<uint32_t>(NativeModuleCache::PrefixHash(wire_bytes));
+    SNPrintF(filename, "profile-wasm-prefix-%08x", prefix_hash);
+    base::OwnedVector<uint8_t> tiering_data =
+        profile_generator.GetTieringData();
+    PrintF("Dumping Wasm tiering PGO data to file '%s' (%zu bytes)\n",
+           filename.begin(), tiering_data.size());
+    WriteProfileFile(filename.begin(), tiering_data.as_vector());
   }
 }
 
@@ -227,28 +331,29 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
   base::EmbeddedVector<char, 32> filename;
   SNPrintF(filename, "profile-wasm-%08x", hash);
 
-  FILE* file = base::OS::FOpen(filename.begin(), "rb");
-  if (!file) {
-    PrintF("No Wasm PGO data found: Cannot open file '%s'\n", filename.begin());
-    return {};
-  }
+  base::OwnedVector<uint8_t> profile_data = ReadProfileFile(filename.begin());
+  if (profile_data.empty()) return {};
 
-  fseek(file, 0, SEEK_END);
-  size_t size = ftell(file);
-  rewind(file);
+  return RestoreProfileData(module, profile_data.as_vector());
+}
 
-  PrintF("Loading Wasm PGO data from file '%s' (%zu bytes)\n", filename.begin(),
-         size);
-  base::OwnedVector<uint8_t> profile_data =
-      base::OwnedVector<uint8_t>::NewForOverwrite(size);
-  for (size_t read = 0; read < size;) {
-    read += fread(profile_data.begin() + read, 1, size - read, file);
-    CHECK(!ferror(file));
-  }
+std::unique_ptr<ProfileInformation> LoadTieringProfileForPrefixFromFile(
+    const WasmModule* module, size_t prefix_hash) {
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-prefix-%08x",
+           static_cast<uint32_t>(prefix_hash));
 
-  base::Fclose(file);
+  base::OwnedVector<uint8_t> profile_data = ReadProfileFile(filename.begin());
+  if (profile_data.empty()) return {};
 
-  return RestoreProfileData(module, profile_data.as_vector());
+  Decoder decoder{profile_data.begin(), profile_data.end()};
+  std::unique_ptr<ProfileInformation> pgo_info =
+      DeserializeTieringInformation(decoder, module);
+
+  CHECK(decoder.ok());
+  CHECK_EQ(decoder.pc(), decoder.end());
+
+  return pgo_info;
 }
 
 }  // namespace v8::internal::wasm
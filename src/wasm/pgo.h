@@ -20,9 +20,11 @@ struct WasmModule;
 class ProfileInformation {
  public:
   ProfileInformation(std::vector<uint32_t> executed_functions,
-                     std::vector<uint32_t> tiered_up_functions)
+                     std::vector<uint32_t> tiered_up_functions,
+                     std::vector<uint32_t> consumed_budgets)
       : executed_functions_(std::move(executed_functions)),
-        tiered_up_functions_(std::move(tiered_up_functions)) {}
+        tiered_up_functions_(std::move(tiered_up_functions)),
+        consumed_budgets_(std::move(consumed_budgets)) {}
 
   // Disallow copying (not needed, so most probably a bug).
   ProfileInformation(const ProfileInformation&) = delete;
@@ -31,21 +33,36 @@ class ProfileInformation {
   base::Vector<const uint32_t> executed_functions() const {
     return base::VectorOf(executed_functions_);
   }
+  // Tiered-up functions, hottest first.
   base::Vector<const uint32_t> tiered_up_functions() const {
     return base::VectorOf(tiered_up_functions_);
   }
+  // Tiering budget consumed per declared function during the profiling run.
+  // Empty if the profile does not contain budgets.
+  base::Vector<const uint32_t> consumed_budgets() const {
+    return base::VectorOf(consumed_budgets_);
+  }
 
  private:
   const std::vector<uint32_t> executed_functions_;
   const std::vector<uint32_t> tiered_up_functions_;
+  const std::vector<uint32_t> consumed_budgets_;
 };
 
-void DumpProfileToFile(const WasmModule* module,
-                       base::Vector<const uint8_t> wire_bytes,
-                       std::atomic<uint32_t>* tiering_budget_array);
+V8_EXPORT_PRIVATE void DumpProfileToFile(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array);
+
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+LoadProfileFromFile(const WasmModule* module,
+                    base::Vector<const uint8_t> wire_bytes);
 
-V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
-    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+// Loads only the tiering part of a profile, looked up by the prefix hash of the
+// module (see {NativeModuleCache::PrefixHash}). Used for streaming compilation,
+// before the function bodies are available.
+V8_EXPORT_PRIVATE V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation>
+LoadTieringProfileForPrefixFromFile(const WasmModule* module,
+                                    size_t prefix_hash);
 
 }  // namespace v8::internal::wasm
 
@@ -4182,6 +4182,26 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         MemoryIndexToUintPtrOrOOBTrap(dst_is_mem64, dst.op);
     V<WordPtr> src_uintptr =
         MemoryIndexToUintPtrOrOOBTrap(src_is_mem64, src.op);
+    if (std::optional<uint32_t> inline_size = InlineBulkMemorySize(size.op)) {
+      BoundsCheckMemRange(imm.memory_dst.memory, dst_uintptr, *inline_size);
+      BoundsCheckMemRange(imm.memory_src.memory, src_uintptr, *inline_size);
+      V<WordPtr> dst_start = MemStart(imm.memory_dst.index);
+      V<WordPtr> src_start = MemStart(imm.memory_src.index);
+      // Load everything before storing anything, so overlapping ranges are
+      // handled like {std::memmove}.
+      base::SmallVector<BulkMemoryChunk, 8> chunks =
+          SplitBulkMemoryAccess(*inline_size);
+      base::SmallVector<OpIndex, 8> values;
+      for (const BulkMemoryChunk& chunk : chunks) {
+        values.push_back(__ Load(src_start, src_uintptr, chunk.kind,
+                                 chunk.repr, chunk.offset));
+      }
+      for (size_t i = 0; i < chunks.size(); ++i) {
+        __ Store(dst_start, dst_uintptr, values[i], chunks[i].kind,
+                 chunks[i].repr, compiler::kNoWriteBarrier, chunks[i].offset);
+      }
+      return;
+    }
     V<WordPtr> size_uintptr =
         MemoryIndexToUintPtrOrOOBTrap(dst_is_mem64 && src_is_mem64, size.op);
     auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
@@ -4203,6 +4223,38 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     bool is_memory_64 = imm.memory->is_memory64;
     V<WordPtr> dst_uintptr =
         MemoryIndexToUintPtrOrOOBTrap(is_memory_64, dst.op);
+    if (std::optional<uint32_t> inline_size = InlineBulkMemorySize(size.op)) {
+      BoundsCheckMemRange(imm.memory, dst_uintptr, *inline_size);
+      V<WordPtr> dst_start = MemStart(imm.index);
+      V<Word32> byte = __ Word32BitwiseAnd(value.op, 0xFF);
+      for (const BulkMemoryChunk& chunk :
+           SplitBulkMemoryAccess(*inline_size)) {
+        OpIndex pattern;
+        switch (chunk.repr.SizeInBytes()) {
+          case 1:
+            pattern = byte;
+            break;
+          case 2:
+            pattern = __ Word32Mul(byte, 0x0101);
+            break;
+          case 4:
+            pattern = __ Word32Mul(byte, 0x01010101);
+            break;
+          case 8:
+            pattern = __ Word64Mul(__ ChangeUint32ToUint64(byte),
+                                   uint64_t{0x0101010101010101});
+            break;
+          case 16:
+            pattern = __ Simd128Splat(byte, Simd128SplatOp::Kind::kI8x16);
+            break;
+          default:
+            UNREACHABLE();
+        }
+        __ Store(dst_start, dst_uintptr, pattern, chunk.kind, chunk.repr,
+                 compiler::kNoWriteBarrier, chunk.offset);
+      }
+      return;
+    }
     V<WordPtr> size_uintptr =
         MemoryIndexToUintPtrOrOOBTrap(is_memory_64, size.op);
     auto sig = FixedSizeSignature<MachineType>::Returns(MachineType::Int32())
@@ -7042,7 +7094,9 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     if (bounds_checks == kTrapHandler &&
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
-      if (memory->is_memory64) {
+      if (memory->is_memory64 &&
+          !IndexWithinMemory64Guards(V<Word64>::Cast(converted_index),
+                                     memory)) {
         V<Word32> cond = __ __ Uint64LessThan(
             V<Word64>::Cast(converted_index),
             __ Word64Constant(memory->GetMemory64GuardsSize()));
@@ -7068,6 +7122,90 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
     return {converted_index, compiler::BoundsCheckResult::kDynamicallyChecked};
   }
 
+  // Only indexes beyond the guard regions of a memory64 need an explicit check
+  // when using the trap handler. Returns whether {index} is known to be small
+  // enough, e.g. because it was zero-extended from an i32.
+  bool IndexWithinMemory64Guards(V<Word64> index, const WasmMemory* memory) {
+    if (!index.valid()) return false;
+    const uint64_t guards_size = memory->GetMemory64GuardsSize();
+    const Operation& op = __ output_graph().Get(index);
+    if (const ConstantOp* constant = op.TryCast<ConstantOp>()) {
+      return constant->IsIntegral() && constant->integral() < guards_size;
+    }
+    if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+      return change->kind == ChangeOp::Kind::kZeroExtend &&
+             change->from == RegisterRepresentation::Word32() &&
+             guards_size > kMaxUInt32;
+    }
+    return false;
+  }
+
+  // Largest constant size of a memory.copy or memory.fill that is lowered to
+  // inline loads and stores instead of a C call.
+  static constexpr uint32_t kMaxInlineBulkMemorySize = 64;
+
+  struct BulkMemoryChunk {
+    MemoryRepresentation repr;
+    LoadOp::Kind kind;
+    int32_t offset;
+  };
+
+  // Returns the size of a memory.copy or memory.fill if it should be lowered
+  // inline, i.e. if it is a small non-zero constant.
+  std::optional<uint32_t> InlineBulkMemorySize(OpIndex size) {
+    if (!v8_flags.wasm_inline_bulk_memory) return std::nullopt;
+    const ConstantOp* constant =
+        __ output_graph().Get(size).TryCast<ConstantOp>();
+    if (constant == nullptr || !constant->IsIntegral()) return std::nullopt;
+    uint64_t value = constant->integral();
+    if (value == 0 || value > kMaxInlineBulkMemorySize) return std::nullopt;
+    return static_cast<uint32_t>(value);
+  }
+
+  // Covers {size} bytes with as few accesses as possible, using 128-bit
+  // accesses if SIMD is supported.
+  base::SmallVector<BulkMemoryChunk, 8> SplitBulkMemoryAccess(uint32_t size) {
+    base::SmallVector<BulkMemoryChunk, 8> chunks;
+    int32_t offset = 0;
+    auto add_chunks = [&](MemoryRepresentation repr) {
+      const uint32_t chunk_size = repr.SizeInBytes();
+      LoadOp::Kind kind = GetMemoryAccessKind(
+          repr, compiler::BoundsCheckResult::kDynamicallyChecked);
+      for (; size >= chunk_size; size -= chunk_size, offset += chunk_size) {
+        chunks.push_back({repr, kind, offset});
+      }
+    };
+    if (CpuFeatures::SupportsWasmSimd128()) {
+      add_chunks(MemoryRepresentation::Simd128());
+    }
+    if constexpr (Is64()) add_chunks(MemoryRepresentation::Uint64());
+    add_chunks(MemoryRepresentation::Uint32());
+    add_chunks(MemoryRepresentation::Uint16());
+    add_chunks(MemoryRepresentation::Uint8());
+    DCHECK_EQ(0, size);
+    return chunks;
+  }
+
+  // Traps unless all of [index, index + size) is within {memory}. Bulk memory
+  // operations must not write anything if they trap, so this cannot rely on
+  // the trap handler.
+  void BoundsCheckMemRange(const wasm::WasmMemory* memory, V<WordPtr> index,
+                           uint32_t size) {
+    DCHECK_LT(0, size);
+    V<WordPtr> memory_size = MemSize(memory->index);
+    uintptr_t end_offset = size - 1u;
+    if (end_offset > memory->min_memory_size) {
+      __ TrapIfNot(
+          __ UintPtrLessThan(__ UintPtrConstant(end_offset), memory_size),
+          TrapId::kTrapMemOutOfBounds);
+    }
+    // This produces a positive number since {end_offset <= min_size <=
+    // mem_size}.
+    V<WordPtr> effective_size = __ WordPtrSub(memory_size, end_offset);
+    __ TrapIfNot(__ UintPtrLessThan(index, effective_size),
+                 TrapId::kTrapMemOutOfBounds);
+  }
+
   V<WordPtr> MemStart(uint32_t index) {
     if (index == 0) {
       // TODO(14108): Port TF's dynamic "cached_memory_index" infrastructure.
@@ -814,6 +814,11 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForWrapper(size_t size) {
 base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
     NativeModule* native_module, size_t size, base::AddressRegion region) {
   DCHECK_LT(0, size);
+  if (v8_flags.wasm_code_compaction && region == kUnrestrictedRegion) {
+    base::Vector<uint8_t> reused_space = AllocateInFreedCodeSpace(
+        size, std::numeric_limits<Address>::max());
+    if (!reused_space.empty()) return reused_space;
+  }
   auto* code_manager = GetWasmCodeManager();
   size = RoundUp<kCodeAlignment>(size);
   base::AddressRegion code_space =
@@ -891,6 +896,50 @@ base::Vector<uint8_t> WasmCodeAllocator::AllocateForCodeInRegion(
   return {reinterpret_cast<uint8_t*>(code_space.begin()), code_space.size()};
 }
 
+base::Vector<uint8_t> WasmCodeAllocator::AllocateInFreedCodeSpace(
+    size_t size, Address limit) {
+  DCHECK(v8_flags.wasm_code_compaction);
+  DCHECK_LT(0, size);
+  size = RoundUp<kCodeAlignment>(size);
+  // Allocate the lowest fitting region, to keep code packed towards the start
+  // of the code space.
+  base::AddressRegion code_space =
+      freed_code_space_.AllocateInRegion(size, {kNullAddress, limit});
+  if (code_space.is_empty()) return {};
+
+  // Full pages of freed code were discarded in {FreeCode}. Recommit the ones
+  // which overlap with the new allocation. Partially freed pages were never
+  // discarded and are still committed.
+  const Address commit_page_size = CommitPageSize();
+  Address pages_start = RoundDown(code_space.begin(), commit_page_size);
+  Address pages_end = RoundUp(code_space.end(), commit_page_size);
+  base::AddressRegion pages{pages_start, pages_end - pages_start};
+  base::SmallVector<base::AddressRegion, 4> regions_to_commit;
+  for (auto region : decommitted_code_space_.regions()) {
+    if (region.begin() >= pages.end()) break;
+    base::AddressRegion overlap = region.GetOverlap(pages);
+    if (!overlap.is_empty()) regions_to_commit.emplace_back(overlap);
+  }
+  auto* code_manager = GetWasmCodeManager();
+  for (auto region : regions_to_commit) {
+    CHECK_EQ(region,
+             decommitted_code_space_.AllocateInRegion(region.size(), region));
+    for (base::AddressRegion split_range :
+         SplitRangeByReservationsIfNeeded(region, owned_code_space_)) {
+      code_manager->Commit(split_range);
+    }
+    committed_code_space_.fetch_add(region.size());
+  }
+  DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
+  generated_code_size_.fetch_add(code_space.size(), std::memory_order_relaxed);
+  [[maybe_unused]] size_t old_freed = freed_code_size_.fetch_sub(size);
+  DCHECK_GE(old_freed, size);
+
+  TRACE_HEAP("Reused code space for %p: 0x%" PRIxPTR ",+%zu\n", this,
+             code_space.begin(), size);
+  return {reinterpret_cast<uint8_t*>(code_space.begin()), code_space.size()};
+}
+
 void WasmCodeAllocator::FreeCode(base::Vector<WasmCode* const> codes) {
   // Zap code area and collect freed code regions.
   DisjointAllocationPool freed_regions;
@@ -930,6 +979,7 @@ void WasmCodeAllocator::FreeCode(base::Vector<WasmCode* const> codes) {
          SplitRangeByReservationsIfNeeded(region, owned_code_space_)) {
       code_manager->Decommit(split_range);
     }
+    if (v8_flags.wasm_code_compaction) decommitted_code_space_.Merge(region);
   }
 }
 
@@ -1550,6 +1600,38 @@ std::unique_ptr<WasmCode> NativeModule::AddDeserializedCode(
       inlining_positions, deopt_data, kind, tier, kNotForDebugging}};
 }
 
+void NativeModule::SetDeferredDeserializedCode(
+    base::OwnedVector<const uint8_t> serialized_code,
+    std::map<int, base::Vector<const uint8_t>> functions) {
+  base::RecursiveMutexGuard guard{&allocation_mutex_};
+  DCHECK_NULL(deferred_code_bytes_);
+  DCHECK(deferred_code_.empty());
+  deferred_code_bytes_ = std::make_shared<base::OwnedVector<const uint8_t>>(
+      std::move(serialized_code));
+  deferred_code_ = std::move(functions);
+}
+
+base::Vector<const uint8_t> NativeModule::TakeDeferredDeserializedCode(
+    int func_index,
+    std::shared_ptr<const base::OwnedVector<const uint8_t>>* keep_alive) {
+  base::RecursiveMutexGuard guard{&allocation_mutex_};
+  auto it = deferred_code_.find(func_index);
+  if (it == deferred_code_.end()) return {};
+  base::Vector<const uint8_t> serialized_code = it->second;
+  deferred_code_.erase(it);
+  *keep_alive = deferred_code_bytes_;
+  // Once every deferred function was taken, the module does not need the
+  // serialized code anymore. The buffer is freed as soon as the last caller
+  // is done reading from it.
+  if (deferred_code_.empty()) deferred_code_bytes_.reset();
+  return serialized_code;
+}
+
+bool NativeModule::HasDeferredDeserializedCode() const {
+  base::RecursiveMutexGuard guard{&allocation_mutex_};
+  return !deferred_code_.empty();
+}
+
 std::pair<std::vector<WasmCode*>, std::vector<WellKnownImport>>
 NativeModule::SnapshotCodeTable() const {
   base::RecursiveMutexGuard lock(&allocation_mutex_);
@@ -2657,6 +2739,114 @@ void NativeModule::FreeCode(base::Vector<WasmCode* const> codes) {
   if (debug_info) debug_info->RemoveDebugSideTables(codes);
 }
 
+std::vector<WasmCode*> NativeModule::CompactCode() {
+  DCHECK(v8_flags.wasm_code_compaction);
+  TRACE_EVENT0("v8.wasm", "wasm.CompactCode");
+  std::vector<WasmCode*> relocated_code;
+  base::RecursiveMutexGuard guard(&allocation_mutex_);
+  // Debug code is replaced on every change of the debug state anyway.
+  if (debug_state_ == kDebugging) return relocated_code;
+
+  // Only Turbofan code keeps its relocation information (see
+  // {AddCodeWithCodeSpace}), so Liftoff code cannot be moved.
+  std::vector<WasmCode*> candidates;
+  for (uint32_t i = 0; i < module_->num_declared_functions; ++i) {
+    WasmCode* code = code_table_[i];
+    if (code == nullptr || !code->is_turbofan() || code->for_debugging()) {
+      continue;
+    }
+    candidates.push_back(code);
+  }
+  // Move the code at the highest addresses first, so it fills the lowest holes.
+  std::sort(candidates.begin(), candidates.end(),
+            [](WasmCode* a, WasmCode* b) {
+              return a->instruction_start() > b->instruction_start();
+            });
+
+  for (WasmCode* code : candidates) {
+    base::Vector<uint8_t> code_space = code_allocator_.AllocateInFreedCodeSpace(
+        code->instructions().size(), code->instruction_start());
+    if (code_space.empty()) continue;
+    ThreadIsolation::RegisterJitAllocation(
+        reinterpret_cast<Address>(code_space.begin()), code_space.size(),
+        ThreadIsolation::JitAllocationType::kWasmCode);
+    // Publishing replaces {code} in the code table and the jump tables, and
+    // keeps it alive in the current {WasmCodeRefScope}. Frames which still
+    // execute it are found by the next code GC.
+    relocated_code.push_back(
+        PublishCodeLocked(RelocateCodeLocked(code, code_space)));
+  }
+  num_relocated_code_ += relocated_code.size();
+  return relocated_code;
+}
+
+size_t NativeModule::GetNumberOfRelocatedCodeForTesting() const {
+  base::RecursiveMutexGuard guard(&allocation_mutex_);
+  return num_relocated_code_;
+}
+
+std::unique_ptr<WasmCode> NativeModule::RelocateCodeLocked(
+    WasmCode* code, base::Vector<uint8_t> dst_code_bytes) {
+  allocation_mutex_.AssertHeld();
+  DCHECK_EQ(code->instructions().size(), dst_code_bytes.size());
+  JumpTablesRef jump_tables =
+      FindJumpTablesForRegionLocked(base::AddressRegionOf(dst_code_bytes));
+
+  {
+    WritableJitAllocation jit_allocation = ThreadIsolation::LookupJitAllocation(
+        reinterpret_cast<Address>(dst_code_bytes.begin()),
+        dst_code_bytes.size(), ThreadIsolation::JitAllocationType::kWasmCode);
+    jit_allocation.CopyCode(0, code->instructions().begin(),
+                            code->instructions().size());
+
+    // Calls are redirected to the jump tables of the new code space, all other
+    // references get the relocation delta applied.
+    intptr_t delta = dst_code_bytes.begin() - code->instructions().begin();
+    int mode_mask = RelocInfo::kApplyMask |
+                    RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
+                    RelocInfo::ModeMask(RelocInfo::WASM_STUB_CALL);
+    Address constant_pool_start =
+        reinterpret_cast<Address>(dst_code_bytes.begin()) +
+        code->constant_pool_offset();
+    RelocIterator orig_it(code->instructions(), code->reloc_info(),
+                          code->constant_pool(), mode_mask);
+    for (WritableRelocIterator it(jit_allocation, dst_code_bytes,
+                                  code->reloc_info(), constant_pool_start,
+                                  mode_mask);
+         !it.done(); it.next(), orig_it.next()) {
+      RelocInfo::Mode mode = it.rinfo()->rmode();
+      if (RelocInfo::IsWasmCall(mode)) {
+        uint32_t func_index = GetFunctionIndexFromJumpTableSlot(
+            orig_it.rinfo()->wasm_call_address());
+        it.rinfo()->set_wasm_call_address(
+            GetNearCallTargetForFunction(func_index, jump_tables));
+      } else if (RelocInfo::IsWasmStubCall(mode)) {
+        Builtin builtin = GetBuiltinInJumptableSlot(
+            orig_it.rinfo()->wasm_stub_call_address());
+        DCHECK_NE(Builtin::kNoBuiltinId, builtin);
+        it.rinfo()->set_wasm_stub_call_address(
+            GetJumpTableEntryForBuiltin(builtin, jump_tables));
+      } else {
+        it.rinfo()->apply(delta);
+      }
+    }
+  }
+
+  FlushInstructionCache(dst_code_bytes.begin(), dst_code_bytes.size());
+
+  std::unique_ptr<WasmCode> new_code{new WasmCode{
+      this, code->index(), dst_code_bytes, code->stack_slots(),
+      code->ool_spills(), code->raw_tagged_parameter_slots_for_serialization(),
+      code->safepoint_table_offset(), code->handler_table_offset(),
+      code->constant_pool_offset(), code->code_comments_offset(),
+      code->unpadded_binary_size(), code->protected_instructions_data(),
+      code->reloc_info(), code->source_positions(), code->inlining_positions(),
+      code->deopt_data(), code->kind(), code->tier(), code->for_debugging(),
+      code->frame_has_feedback_slot()}};
+  new_code->Validate();
+  return new_code;
+}
+
 size_t NativeModule::GetNumberOfCodeSpacesForTesting() const {
   base::RecursiveMutexGuard guard{&allocation_mutex_};
   return code_allocator_.GetNumCodeSpaces();
@@ -2684,7 +2874,7 @@ NamesProvider* NativeModule::GetNamesProvider() {
 }
 
 size_t NativeModule::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 480);
+  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 552);
   size_t result = sizeof(NativeModule);
   result += module_->EstimateCurrentMemoryConsumption();
 
@@ -2728,6 +2918,9 @@ size_t NativeModule::EstimateCurrentMemoryConsumption() const {
     // For {code_table_}.
     result += module_->num_declared_functions * sizeof(void*);
     result += ContentSize(code_space_data_);
+    // The entries of {deferred_code_} point into {deferred_code_bytes_}.
+    if (deferred_code_bytes_) result += deferred_code_bytes_->size();
+    result += ContentSize(deferred_code_);
     debug_info = debug_info_.get();
     if (names_provider_) {
       result += names_provider_->EstimateCurrentMemoryConsumption();
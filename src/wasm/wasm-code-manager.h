@@ -503,6 +503,12 @@ class WasmCodeAllocator {
   base::Vector<uint8_t> AllocateForCodeInRegion(NativeModule*, size_t size,
                                                 base::AddressRegion);
 
+  // Allocate code space which was freed by the wasm code GC before, entirely
+  // below {limit}. Returns an empty buffer if no such space is available.
+  // Only used with --wasm-code-compaction.
+  // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
+  base::Vector<uint8_t> AllocateInFreedCodeSpace(size_t size, Address limit);
+
   // Free memory pages of all given code objects. Used for wasm code GC.
   // Hold the {NativeModule}'s {allocation_mutex_} when calling this method.
   void FreeCode(base::Vector<WasmCode* const>);
@@ -522,8 +528,12 @@ class WasmCodeAllocator {
   DisjointAllocationPool free_code_space_;
   // Code space that was allocated before but is dead now. Full
   // pages within this region are discarded. It's still a subset of
-  // {owned_code_space_}.
+  // {owned_code_space_}. With --wasm-code-compaction, this space is handed out
+  // again for new allocations.
   DisjointAllocationPool freed_code_space_;
+  // The discarded pages within {freed_code_space_}. Only tracked with
+  // --wasm-code-compaction, to recommit them when the space gets reused.
+  DisjointAllocationPool decommitted_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
   // End of fields protected by {mutex_}.
@@ -602,6 +612,22 @@ class V8_EXPORT_PRIVATE NativeModule final {
       base::Vector<const uint8_t> deopt_data, WasmCode::Kind kind,
       ExecutionTier tier);
 
+  // Keeps the serialized code of functions whose deserialization was deferred
+  // to their first call (see --wasm-lazy-deserialization). The vectors in
+  // {functions} point into {serialized_code}.
+  void SetDeferredDeserializedCode(
+      base::OwnedVector<const uint8_t> serialized_code,
+      std::map<int, base::Vector<const uint8_t>> functions);
+  // Returns the serialized code of {func_index} and forgets about it, such that
+  // it is materialized at most once. Returns an empty vector if the function
+  // was not deferred or was already taken. The returned vector stays valid as
+  // long as {keep_alive} is held; the module releases its own reference to
+  // the serialized code once all deferred functions were taken.
+  base::Vector<const uint8_t> TakeDeferredDeserializedCode(
+      int func_index,
+      std::shared_ptr<const base::OwnedVector<const uint8_t>>* keep_alive);
+  bool HasDeferredDeserializedCode() const;
+
   // Adds anonymous code for testing purposes.
   WasmCode* AddCodeForTesting(DirectHandle<Code> code);
 
@@ -785,9 +811,20 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // its accounting.
   void FreeCode(base::Vector<WasmCode* const>);
 
+  // Move live optimized code into code space at lower addresses which was
+  // freed by the wasm code GC. The copies replace the original code in the
+  // code table and jump tables; the original code becomes potentially dead and
+  // is freed by a later GC. Returns the new code objects, which are added to
+  // the current {WasmCodeRefScope}.
+  // Only used with --wasm-code-compaction.
+  std::vector<WasmCode*> CompactCode();
+
   // Retrieve the number of separately reserved code spaces for this module.
   size_t GetNumberOfCodeSpacesForTesting() const;
 
+  // Retrieve the number of code objects moved by {CompactCode} so far.
+  size_t GetNumberOfRelocatedCodeForTesting() const;
+
   // Check whether there is DebugInfo for this NativeModule.
   bool HasDebugInfo() const;
 
@@ -928,6 +965,11 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // Hold the {allocation_mutex_} when calling {PublishCodeLocked}.
   WasmCode* PublishCodeLocked(std::unique_ptr<WasmCode>);
 
+  // Copy {code} to {dst_code_bytes} and update all position-dependent parts of
+  // the copy. Hold the {allocation_mutex_} when calling this method.
+  std::unique_ptr<WasmCode> RelocateCodeLocked(
+      WasmCode* code, base::Vector<uint8_t> dst_code_bytes);
+
   // Transfer owned code from {new_owned_code_} to {owned_code_}.
   void TransferNewOwnedCodeLocked() const;
 
@@ -1030,6 +1072,15 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   std::unique_ptr<NamesProvider> names_provider_;
 
+  // Serialized code of functions whose deserialization was deferred, see
+  // {SetDeferredDeserializedCode}. Entries are removed once they are
+  // materialized, and the buffer is released after the last one.
+  std::shared_ptr<const base::OwnedVector<const uint8_t>> deferred_code_bytes_;
+  std::map<int, base::Vector<const uint8_t>> deferred_code_;
+
+  // Number of code objects moved by {CompactCode}, for testing.
+  size_t num_relocated_code_ = 0;
+
   DebugState debug_state_ = kNotDebugging;
 
   // End of fields protected by {allocation_mutex_}.
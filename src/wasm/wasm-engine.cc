@@ -188,6 +188,28 @@ class WasmGCForegroundTask : public CancelableTask {
   Isolate* isolate_;
 };
 
+// Moves live code of a {NativeModule} into the code space freed by the last
+// code GC. This copies machine code, so it runs on a background thread.
+class CompactCodeSpaceTask : public v8::Task {
+ public:
+  explicit CompactCodeSpaceTask(std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void Run() final {
+    std::shared_ptr<NativeModule> native_module = native_module_.lock();
+    if (!native_module) return;
+    WasmCodeRefScope code_ref_scope;
+    std::vector<WasmCode*> relocated_code = native_module->CompactCode();
+    TRACE_CODE_GC("Relocated %zu code object%s of module %p.\n",
+                  relocated_code.size(),
+                  relocated_code.size() == 1 ? "" : "s", native_module.get());
+    GetWasmEngine()->LogCode(base::VectorOf(relocated_code));
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+};
+
 class ClearWeakScriptHandleTask : public CancelableTask {
  public:
   explicit ClearWeakScriptHandleTask(Isolate* isolate,
@@ -1956,6 +1978,15 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
 
   FreeDeadCodeLocked(dead_code, dead_wrappers);
 
+  if (v8_flags.wasm_code_compaction) {
+    for (auto& dead_code_entry : dead_code) {
+      auto it = native_modules_.find(dead_code_entry.first);
+      if (it == native_modules_.end()) continue;
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          std::make_unique<CompactCodeSpaceTask>(it->second->weak_ptr));
+    }
+  }
+
   TRACE_CODE_GC("Found %zu dead code objects, freed %zu.\n",
                 current_gc_info_->dead_code.size(), num_freed);
   USE(num_freed);
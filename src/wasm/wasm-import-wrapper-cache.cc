@@ -4,11 +4,14 @@
 
 #include "src/wasm/wasm-import-wrapper-cache.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/flush-instruction-cache.h"
 #include "src/common/code-memory-access-inl.h"
+#include "src/compiler/wasm-compiler.h"
+#include "src/logging/counters.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/std-object-sizes.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -182,6 +185,56 @@ WasmCode* WasmImportWrapperCache::MaybeGet(ImportCallKind kind,
   return it->second;
 }
 
+WasmCode* WasmImportWrapperCache::CompileWasmImportCallWrapper(
+    Isolate* isolate, NativeModule* native_module, ImportCallKind kind,
+    const FunctionSig* sig, uint32_t canonical_type_index,
+    bool source_positions, int expected_arity, Suspend suspend) {
+  CacheKey key(kind, canonical_type_index, expected_arity, suspend);
+  {
+    base::MutexGuard lock(&mutex_);
+    while (true) {
+      auto it = entry_map_.find(key);
+      if (it != entry_map_.end() && it->second != nullptr) {
+        WasmCodeRefScope::AddRef(it->second);
+        return it->second;
+      }
+      if (std::find(keys_being_compiled_.begin(), keys_being_compiled_.end(),
+                    key) == keys_being_compiled_.end()) {
+        break;
+      }
+      compilation_finished_.Wait(&mutex_);
+    }
+    keys_being_compiled_.push_back(key);
+  }
+
+  CompilationEnv env = CompilationEnv::ForModule(native_module);
+  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
+      &env, kind, sig, source_positions, expected_arity, suspend);
+  WasmCode* code;
+  {
+    ModificationScope cache_scope(this);
+    code = cache_scope.AddWrapper(key, std::move(result),
+                                  WasmCode::Kind::kWasmToJsWrapper);
+    keys_being_compiled_.erase(std::find(keys_being_compiled_.begin(),
+                                         keys_being_compiled_.end(), key));
+  }
+  compilation_finished_.NotifyAll();
+
+  // To avoid lock order inversion, code printing must happen after the
+  // end of the {cache_scope}.
+  code->MaybePrint();
+  isolate->counters()->wasm_generated_code_size()->Increment(
+      code->instructions().length());
+  isolate->counters()->wasm_reloc_size()->Increment(
+      code->reloc_info().length());
+  if (V8_UNLIKELY(native_module->log_code())) {
+    GetWasmEngine()->LogWrapperCode(base::VectorOf(&code, 1));
+    // Log the code immediately in the current isolate.
+    GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+  }
+  return code;
+}
+
 WasmCode* WasmImportWrapperCache::Lookup(Address pc) const {
   // This can be called from the disassembler via `code->MaybePrint()` in
   // `AddWrapper()` above, so we need a recursive mutex.
@@ -197,10 +250,10 @@ WasmCode* WasmImportWrapperCache::Lookup(Address pc) const {
 }
 
 size_t WasmImportWrapperCache::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 120);
+  UPDATE_WHEN_CLASS_CHANGES(WasmImportWrapperCache, 192);
   base::MutexGuard lock(&mutex_);
   return sizeof(WasmImportWrapperCache) + ContentSize(entry_map_) +
-         ContentSize(codes_);
+         ContentSize(codes_) + ContentSize(keys_being_compiled_);
 }
 
 }  // namespace v8::internal::wasm
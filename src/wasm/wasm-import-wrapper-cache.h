@@ -10,7 +10,9 @@
 #define V8_WASM_WASM_IMPORT_WRAPPER_CACHE_H_
 
 #include <unordered_map>
+#include <vector>
 
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/wasm/module-instantiate.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -83,6 +85,17 @@ class WasmImportWrapperCache {
                                        int expected_arity,
                                        Suspend suspend) const;
 
+  // Thread-safe. Returns the cached wasm-to-JS wrapper for the given key, or
+  // compiles and caches a new one. Since the cache is shared by all isolates,
+  // concurrent requests for the same key (e.g. from several isolates
+  // instantiating the same module) wait for a single compilation instead of
+  // compiling duplicates. Adds the returned code to the surrounding
+  // WasmCodeRefScope.
+  V8_EXPORT_PRIVATE WasmCode* CompileWasmImportCallWrapper(
+      Isolate* isolate, NativeModule* native_module, ImportCallKind kind,
+      const FunctionSig* sig, uint32_t canonical_type_index,
+      bool source_positions, int expected_arity, Suspend suspend);
+
   WasmCode* Lookup(Address pc) const;
 
   void LogForIsolate(Isolate* isolate);
@@ -104,6 +117,12 @@ class WasmImportWrapperCache {
   std::unordered_map<CacheKey, WasmCode*, CacheKeyHash> entry_map_;
   // Lookup support. The map key is the instruction start address.
   std::map<Address, WasmCode*> codes_;
+  // Keys of wrappers currently being compiled by
+  // {CompileWasmImportCallWrapper}. There are only ever a few, so a vector is
+  // good enough.
+  std::vector<CacheKey> keys_being_compiled_;
+  // Signalled (under {mutex_}) whenever a compilation finishes.
+  base::ConditionVariable compilation_finished_;
 };
 
 }  // namespace v8::internal::wasm
@@ -214,6 +214,11 @@ constexpr size_t kCodeHeaderSize = sizeof(uint8_t) +  // code kind
                                    sizeof(WasmCode::Kind) +  // code kind
                                    sizeof(ExecutionTier);    // tier
 
+// Offset of the code size within the code header above.
+constexpr size_t kCodeSizeOffset = sizeof(uint8_t) +  // code kind
+                                   7 * sizeof(int) +  // offsets and slots
+                                   sizeof(uint32_t);  // tagged parameter slots
+
 // A List of all isolate-independent external references. This is used to create
 // a tag from the Address of an external reference and vice versa.
 class ExternalReferenceList {
@@ -563,8 +568,11 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   for (WasmCode* code : code_table_) {
     WriteCode(code, writer);
   }
-  // No TurboFan-compiled functions in jitless mode.
-  if (!v8_flags.wasm_jitless) {
+  // No TurboFan-compiled functions in jitless mode. Short-running embedders
+  // can opt into caching modules that never tiered up, which still saves
+  // decoding, validation and the lazy compilation of executed functions.
+  if (!v8_flags.wasm_jitless &&
+      !v8_flags.wasm_serialize_without_turbofan_code) {
     // If not a single function was written, serialization was not successful.
     if (num_turbofan_functions_ == 0) return false;
   }
@@ -578,6 +586,15 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module) {
+  // Functions whose deserialization was deferred have no code yet; materialize
+  // them so that their TurboFan code is not lost when serializing again.
+  if (native_module->HasDeferredDeserializedCode()) {
+    for (uint32_t i = native_module->num_imported_functions(),
+                  e = native_module->num_functions();
+         i < e; ++i) {
+      MaterializeDeferredCode(native_module, i);
+    }
+  }
   std::tie(code_table_, import_statuses_) = native_module->SnapshotCodeTable();
 }
 
@@ -654,6 +671,11 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   bool Read(Reader* reader);
 
+  // Copies, relocates and publishes the code of a single function from its
+  // serialized representation, as deferred by {Read}.
+  WasmCode* ReadDeferredCode(int fn_index,
+                             base::Vector<const uint8_t> serialized_code);
+
   base::Vector<const int> lazy_functions() {
     return base::VectorOf(lazy_functions_);
   }
@@ -684,6 +706,10 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModule::JumpTablesRef current_jump_tables_;
   std::vector<int> lazy_functions_;
   std::vector<int> eager_functions_;
+  // If set, {ReadCode} does not allocate TurboFan code but records the
+  // serialized code in {deferred_functions_} instead.
+  bool defer_turbofan_code_ = false;
+  std::vector<std::pair<int, base::Vector<const uint8_t>>> deferred_functions_;
 };
 
 class DeserializeCodeTask : public JobTask {
@@ -768,6 +794,10 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
     native_module_->module()->set_all_functions_validated();
   }
 
+  // Debugging needs Liftoff code anyway, so only defer if not debugging.
+  defer_turbofan_code_ = v8_flags.wasm_lazy_deserialization &&
+                         !native_module_->IsInDebugState();
+
   WasmCodeRefScope wasm_code_ref_scope;
 
   DeserializationQueue reloc_queue;
@@ -812,6 +842,27 @@ bool NativeModuleDeserializer::Read(Reader* reader) {
   // Wait for all tasks to finish, while participating in their work.
   job_handle->Join();
 
+  if (!deferred_functions_.empty()) {
+    // The serialized data is owned by the embedder, so copy the code of all
+    // deferred functions into a buffer owned by the {NativeModule}.
+    size_t total_size = 0;
+    for (auto& [fn_index, serialized_code] : deferred_functions_) {
+      total_size += serialized_code.size();
+    }
+    auto bytes = base::OwnedVector<uint8_t>::NewForOverwrite(total_size);
+    std::map<int, base::Vector<const uint8_t>> functions;
+    size_t offset = 0;
+    for (auto& [fn_index, serialized_code] : deferred_functions_) {
+      base::Vector<uint8_t> copy =
+          bytes.as_vector().SubVector(offset, offset + serialized_code.size());
+      copy.OverwriteWith(serialized_code);
+      functions.emplace(fn_index, copy);
+      offset += serialized_code.size();
+    }
+    native_module_->SetDeferredDeserializedCode(std::move(bytes),
+                                                std::move(functions));
+  }
+
   ReadTieringBudget(reader);
   return reader->current_size() == 0;
 }
@@ -849,6 +900,8 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
     return {};
   }
 
+  const uint8_t* serialized_code_start =
+      reader->current_location() - sizeof(code_kind);
   int constant_pool_offset = reader->Read<int>();
   int safepoint_table_offset = reader->Read<int>();
   int handler_table_offset = reader->Read<int>();
@@ -870,6 +923,20 @@ DeserializationUnit NativeModuleDeserializer::ReadCode(int fn_index,
 
   DCHECK(IsAligned(code_size, kCodeAlignment));
   DCHECK_GE(remaining_code_size_, code_size);
+  if (defer_turbofan_code_) {
+    // Skip the code and metadata for now, the function will go through the
+    // lazy compile stub and get materialized on its first call.
+    reader->Skip(code_size + reloc_size + source_position_size +
+                 inlining_position_size + deopt_data_size +
+                 protected_instructions_size);
+    deferred_functions_.emplace_back(
+        fn_index,
+        base::VectorOf(serialized_code_start,
+                       reader->current_location() - serialized_code_start));
+    remaining_code_size_ -= code_size;
+    lazy_functions_.push_back(fn_index);
+    return {};
+  }
   if (current_code_space_.size() < static_cast<size_t>(code_size)) {
     // Allocate the next code space. Don't allocate more than 90% of
     // {kMaxCodeSpaceSize}, to leave some space for jump tables.
@@ -973,6 +1040,25 @@ void NativeModuleDeserializer::CopyAndRelocate(
                         unit.code->instructions().size());
 }
 
+WasmCode* NativeModuleDeserializer::ReadDeferredCode(
+    int fn_index, base::Vector<const uint8_t> serialized_code) {
+  DCHECK(!defer_turbofan_code_);
+  DCHECK_EQ(kTurboFanFunction, serialized_code[0]);
+  // Allocate exactly the code size of this function.
+  remaining_code_size_ = ReadUnalignedValue<int>(
+      reinterpret_cast<Address>(serialized_code.begin() + kCodeSizeOffset));
+  Reader reader(serialized_code);
+  DeserializationUnit unit = ReadCode(fn_index, &reader);
+  DCHECK_EQ(0, reader.current_size());
+  DCHECK_EQ(0, remaining_code_size_);
+  CopyAndRelocate(unit);
+
+  WasmCode* code = native_module_->PublishCode(std::move(unit).code);
+  code->MaybePrint();
+  code->Validate();
+  return code;
+}
+
 void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
   size_t size_of_tiering_budget =
       native_module_->module()->num_declared_functions * sizeof(uint32_t);
@@ -1000,6 +1086,15 @@ void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
   }
 }
 
+WasmCode* MaterializeDeferredCode(NativeModule* native_module, int func_index) {
+  std::shared_ptr<const base::OwnedVector<const uint8_t>> keep_alive;
+  base::Vector<const uint8_t> serialized_code =
+      native_module->TakeDeferredDeserializedCode(func_index, &keep_alive);
+  if (serialized_code.empty()) return nullptr;
+  NativeModuleDeserializer deserializer(native_module);
+  return deserializer.ReadDeferredCode(func_index, serialized_code);
+}
+
 bool IsSupportedVersion(base::Vector<const uint8_t> header,
                         WasmEnabledFeatures enabled_features) {
   if (header.size() < WasmSerializer::kHeaderSize) return false;
@@ -64,6 +64,13 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     const CompileTimeImports& compile_imports,
     base::Vector<const char> source_url);
 
+// Materializes the code of {func_index} if its deserialization was deferred
+// (see --wasm-lazy-deserialization), and publishes it. Returns nullptr if
+// there is no deferred code for that function. Requires an open
+// {WasmCodeRefScope}.
+V8_EXPORT_PRIVATE WasmCode* MaterializeDeferredCode(NativeModule*,
+                                                    int func_index);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_WASM_SERIALIZATION_H_
@@ -29854,6 +29854,65 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->module_count_, 42);
 }
 
+namespace {
+
+class TieringMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t optimized_count_ = 0;
+  size_t deoptimized_count_ = 0;
+  v8::metrics::JSFunctionOptimized last_optimized_;
+  v8::metrics::JSFunctionDeoptimized last_deoptimized_;
+
+  void AddMainThreadEvent(const v8::metrics::JSFunctionOptimized& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    ++optimized_count_;
+    last_optimized_ = event;
+  }
+
+  void AddMainThreadEvent(const v8::metrics::JSFunctionDeoptimized& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    ++deoptimized_count_;
+    last_deoptimized_ = event;
+  }
+};
+
+}  // namespace
+
+TEST(TriggerJSFunctionTieringMetricsEvents) {
+  if (!i::v8_flags.turbofan || i::v8_flags.always_turbofan) return;
+  i::v8_flags.allow_natives_syntax = true;
+  i::v8_flags.stress_concurrent_allocation = false;
+
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  v8::HandleScope scope(iso);
+  std::shared_ptr<TieringMetricsRecorder> recorder =
+      std::make_shared<TieringMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  CompileRun(
+      "function f(o) { return o.x; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f({x: 1}); f({x: 2});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 3});");
+  CompileRun("f({y: 1, x: 4});");
+
+  v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(1100));
+  while (v8::platform::PumpMessageLoop(i::V8::GetCurrentPlatform(), iso)) {
+  }
+  CHECK_GE(recorder->optimized_count_, 1);
+  CHECK(recorder->last_optimized_.success);
+  CHECK_EQ(recorder->last_optimized_.tier,
+           v8::metrics::OptimizedTier::kTurbofan);
+  CHECK_GT(recorder->last_optimized_.code_size_in_bytes, 0);
+  CHECK_GE(recorder->deoptimized_count_, 1);
+  CHECK_EQ(recorder->last_deoptimized_.tier,
+           v8::metrics::OptimizedTier::kTurbofan);
+  CHECK_NOT_NULL(recorder->last_deoptimized_.reason);
+  CHECK_GE(recorder->last_deoptimized_.script_id, 0);
+}
+
 void SetupCodeLike(LocalContext* env, const char* name,
                    v8::Local<v8::FunctionTemplate> to_string,
                    bool is_code_like) {
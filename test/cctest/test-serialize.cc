@@ -69,6 +69,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 namespace v8 {
 namespace internal {
 
@@ -1803,6 +1804,82 @@ TEST(CodeSerializerWithProfiler) {
   delete cache;
 }
 
+namespace {
+
+Tagged<SharedFunctionInfo> FindInnerFunction(Isolate* isolate,
+                                             Tagged<Script> script) {
+  SharedFunctionInfo::ScriptIterator iter(isolate, script);
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info->is_toplevel()) return info;
+  }
+  UNREACHABLE();
+}
+
+void TestCodeSerializerTieringDecision(bool keep_tiering_decisions,
+                                       CachedTieringDecision expected) {
+  FlagScope<bool> pgo_scope(&v8_flags.profile_guided_optimization, true);
+  FlagScope<bool> keep_scope(&v8_flags.code_cache_tiering_decisions,
+                             keep_tiering_decisions);
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "function f(a) { return a + 1; }";
+
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptDetails default_script_details;
+  ScriptCompiler::CompilationDetails compilation_details;
+  Handle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kEagerCompile, ScriptCompiler::kNoCacheNoReason,
+          NOT_NATIVES_CODE, &compilation_details)
+          .ToHandleChecked();
+  FindInnerFunction(isolate, Cast<Script>(orig->script()))
+      ->set_cached_tiering_decision(CachedTieringDecision::kEarlyTurbofan);
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  uint8_t* buffer = NewArray<uint8_t>(cached_data->length);
+  MemCopy(buffer, cached_data->data, cached_data->length);
+  AlignedCachedData cache(buffer, cached_data->length);
+  cache.AcquireDataOwnership();
+
+  // The decision of the original function is unaffected by serialization.
+  CHECK_EQ(CachedTieringDecision::kEarlyTurbofan,
+           FindInnerFunction(isolate, Cast<Script>(orig->script()))
+               ->cached_tiering_decision());
+
+  DirectHandle<SharedFunctionInfo> copy =
+      CompileScript(isolate, copy_source, default_script_details, &cache,
+                    v8::ScriptCompiler::kConsumeCodeCache);
+  CHECK_NE(*orig, *copy);
+  CHECK_EQ(expected, FindInnerFunction(isolate, Cast<Script>(copy->script()))
+                         ->cached_tiering_decision());
+}
+
+}  // namespace
+
+TEST(CodeSerializerDowngradesTieringDecisions) {
+  TestCodeSerializerTieringDecision(false,
+                                    CachedTieringDecision::kEarlySparkplug);
+}
+
+TEST(CodeSerializerKeepsTieringDecisions) {
+  TestCodeSerializerTieringDecision(true,
+                                    CachedTieringDecision::kEarlyTurbofan);
+}
+
 void TestCodeSerializerOnePlusOneImpl(bool verify_builtins_count = true) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
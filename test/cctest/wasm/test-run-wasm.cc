@@ -153,6 +153,108 @@ WASM_EXEC_TEST(Float64Add) {
   CHECK_EQ(57, r.Call());
 }
 
+// A binop followed by local.set is fused by DrumBrake into a single
+// instruction that writes the result directly into the local's slot.
+WASM_EXEC_TEST(Int32Add_LocalSet) {
+  WasmRunner<int32_t, int32_t, int32_t> r(execution_tier);
+  r.AllocateLocal(kWasmI32);
+  // l2 = p0 + p1; both operands on the stack.
+  r.Build(
+      {WASM_LOCAL_SET(2, WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1))),
+       WASM_LOCAL_GET(2)});
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      CHECK_EQ(base::AddWithWraparound(i, j), r.Call(i, j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(Int32Mul_LocalSet_RegisterOperand) {
+  WasmRunner<int32_t, int32_t, int32_t> r(execution_tier);
+  r.AllocateLocal(kWasmI32);
+  // l2 = p1 * (p0 + 1); the right operand is passed in a register.
+  r.Build({WASM_LOCAL_SET(2, WASM_I32_MUL(WASM_LOCAL_GET(1),
+                                          WASM_I32_ADD(WASM_LOCAL_GET(0),
+                                                       WASM_I32V_1(1)))),
+           WASM_LOCAL_GET(2)});
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      CHECK_EQ(base::MulWithWraparound(j, base::AddWithWraparound(i, 1)),
+               r.Call(i, j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(Int32Binop_LocalSet_OperandIsDestination) {
+  WasmRunner<int32_t, int32_t, int32_t> r(execution_tier);
+  // p0 = p0 + p1; p0 = p1 - p0; p0 = p1 * (p0 + 1)
+  r.Build(
+      {WASM_LOCAL_SET(0, WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1))),
+       WASM_LOCAL_SET(0, WASM_I32_SUB(WASM_LOCAL_GET(1), WASM_LOCAL_GET(0))),
+       WASM_LOCAL_SET(0, WASM_I32_MUL(WASM_LOCAL_GET(1),
+                                      WASM_I32_ADD(WASM_LOCAL_GET(0),
+                                                   WASM_I32V_1(1)))),
+       WASM_LOCAL_GET(0)});
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      int32_t x = base::AddWithWraparound(i, j);
+      x = base::SubWithWraparound(j, x);
+      x = base::MulWithWraparound(j, base::AddWithWraparound(x, 1));
+      CHECK_EQ(x, r.Call(i, j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(Int32Binop_LocalSet_DestinationStillOnStack) {
+  WasmRunner<int32_t, int32_t, int32_t> r(execution_tier);
+  // The first p0 stays on the stack while p0 is overwritten, so it has to
+  // keep the old value: p0 - (p0 = p0 + p1) == -p1.
+  r.Build(
+      {WASM_LOCAL_GET(0),
+       WASM_LOCAL_SET(0, WASM_I32_ADD(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1))),
+       WASM_LOCAL_GET(0), kExprI32Sub,
+       // Same with a register operand: p0 - (p0 = p1 * (p0 + 1)).
+       WASM_LOCAL_GET(0),
+       WASM_LOCAL_SET(0, WASM_I32_MUL(WASM_LOCAL_GET(1),
+                                      WASM_I32_ADD(WASM_LOCAL_GET(0),
+                                                   WASM_I32V_1(1)))),
+       WASM_LOCAL_GET(0), kExprI32Sub, kExprI32Add});
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      int32_t x = base::AddWithWraparound(i, j);
+      int32_t first = base::SubWithWraparound(i, x);
+      int32_t y = base::MulWithWraparound(j, base::AddWithWraparound(x, 1));
+      int32_t second = base::SubWithWraparound(x, y);
+      CHECK_EQ(base::AddWithWraparound(first, second), r.Call(i, j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(Int64Sub_LocalSet_DestinationStillOnStack) {
+  WasmRunner<int64_t, int64_t, int64_t> r(execution_tier);
+  // p0 - (p0 = p0 - p1) == p1
+  r.Build(
+      {WASM_LOCAL_GET(0),
+       WASM_LOCAL_SET(0, WASM_I64_SUB(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1))),
+       WASM_LOCAL_GET(0), kExprI64Sub});
+  FOR_INT64_INPUTS(i) {
+    FOR_INT64_INPUTS(j) { CHECK_EQ(j, r.Call(i, j)); }
+  }
+}
+
+WASM_EXEC_TEST(Float64Add_LocalSet) {
+  WasmRunner<double, double, double> r(execution_tier);
+  r.AllocateLocal(kWasmF64);
+  // l2 = p0 + p1; p0 = l2 * p0
+  r.Build(
+      {WASM_LOCAL_SET(2, WASM_F64_ADD(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1))),
+       WASM_LOCAL_SET(0, WASM_F64_MUL(WASM_LOCAL_GET(2), WASM_LOCAL_GET(0))),
+       WASM_LOCAL_GET(0)});
+  FOR_FLOAT64_INPUTS(i) {
+    FOR_FLOAT64_INPUTS(j) { CHECK_DOUBLE_EQ((i + j) * i, r.Call(i, j)); }
+  }
+}
+
 // clang-format messes up the FOR_INT32_INPUTS macros.
 // clang-format off
 template<typename ctype>
@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstdio>
+
 #include "include/libplatform/libplatform.h"
 #include "src/api/api-inl.h"
 #include "src/base/vector.h"
@@ -11,6 +13,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
@@ -1835,6 +1838,64 @@ STREAM_TEST(TierDownWithError) {
   tester.RunCompilerTasks();
 }
 
+STREAM_TEST(TestTieringProfileAppliedDuringStreaming) {
+  // Tiered-up functions are only recorded with dynamic tiering, and the test
+  // distinguishes Liftoff from TurboFan code.
+  if (!v8_flags.wasm_dynamic_tiering || !v8_flags.liftoff) return;
+
+  FlagScope<bool> pgo_streaming(&v8_flags.experimental_wasm_pgo_streaming,
+                                true);
+  FlagScope<int> tiering_budget(&v8_flags.wasm_tiering_budget, 1000);
+  StreamTester tester(isolate);
+  ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+  base::Vector<const uint8_t> wire_bytes =
+      base::VectorOf(buffer.begin(), buffer.size());
+
+  // Write a profile in which "a" (0) tiered up and "b" (1) consumed part of
+  // its budget, while "c" (2) never ran.
+  {
+    WasmModule profiled_module;
+    profiled_module.num_declared_functions = 3;
+    profiled_module.type_feedback.feedback_for_function[0].tierup_priority = 1;
+    std::atomic<uint32_t> budgets[] = {0, 900, 1000};
+    DumpProfileToFile(&profiled_module, wire_bytes, budgets);
+  }
+  // Only keep the file keyed by the module prefix, which is what streaming
+  // compilation looks up when the code section starts.
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-%08x",
+           static_cast<uint32_t>(GetWireBytesHash(wire_bytes)));
+  std::remove(filename.begin());
+
+  tester.OnBytesReceived(buffer.begin(), buffer.size());
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+
+  SNPrintF(filename, "profile-wasm-prefix-%08x",
+           static_cast<uint32_t>(NativeModuleCache::PrefixHash(wire_bytes)));
+  std::remove(filename.begin());
+
+  NativeModule* native_module = tester.native_module();
+  CHECK_NOT_NULL(native_module);
+  WasmCodeRefScope code_ref_scope;
+  std::vector<WasmCode*> all_code = native_module->SnapshotCodeTable().first;
+  CHECK_EQ(3u, all_code.size());
+  // "a" was compiled with TurboFan without ever running in this process.
+  CHECK_NOT_NULL(all_code[0]);
+  CHECK_EQ(ExecutionTier::kTurbofan, all_code[0]->tier());
+  // "b" was compiled eagerly with Liftoff and resumes with the budget it had
+  // left in the profiling run.
+  CHECK_NOT_NULL(all_code[1]);
+  CHECK_EQ(ExecutionTier::kLiftoff, all_code[1]->tier());
+  CHECK_EQ(900u, native_module->tiering_budget_array()[1].load(
+                     std::memory_order_relaxed));
+  // "c" was not affected by the profile.
+  CHECK_IMPLIES(all_code[2], all_code[2]->tier() == ExecutionTier::kLiftoff);
+  CHECK_EQ(1000u, native_module->tiering_budget_array()[2].load(
+                      std::memory_order_relaxed));
+}
+
 STREAM_TEST(Regress1334651) {
   StreamTester tester(isolate);
 
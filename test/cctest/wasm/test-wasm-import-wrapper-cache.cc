@@ -165,6 +165,39 @@ TEST(CacheHitMissSig) {
   CHECK_EQ(c2, c4);
 }
 
+TEST(CompileWrapperUsesCache) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+
+  auto kind = ImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_ll();
+  int expected_arity = static_cast<int>(sig->parameter_count());
+  uint32_t canonical_type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+  WasmImportWrapperCache* cache = GetWasmImportWrapperCache();
+
+  WasmCode* c1 = cache->CompileWasmImportCallWrapper(
+      isolate, module.get(), kind, sig, canonical_type_index, false,
+      expected_arity, kNoSuspend);
+
+  CHECK_NOT_NULL(c1);
+  CHECK_EQ(WasmCode::Kind::kWasmToJsWrapper, c1->kind());
+
+  // Requesting the same wrapper again (e.g. from another module or isolate)
+  // must not compile a new copy.
+  auto module2 = NewModule(isolate);
+  WasmCode* c2 = cache->CompileWasmImportCallWrapper(
+      isolate, module2.get(), kind, sig, canonical_type_index, false,
+      expected_arity, kNoSuspend);
+  CHECK_EQ(c1, c2);
+
+  WasmCode* c3 =
+      cache->MaybeGet(kind, canonical_type_index, expected_arity, kNoSuspend);
+  CHECK_EQ(c1, c3);
+}
+
 }  // namespace test_wasm_import_wrapper_cache
 }  // namespace wasm
 }  // namespace internal
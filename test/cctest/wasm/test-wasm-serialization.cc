@@ -358,6 +358,29 @@ TEST(TierDownAfterDeserialization) {
   CHECK_NULL(native_module->GetCode(0));
 }
 
+TEST(LazyDeserialization) {
+  FlagScope<bool> lazy_deserialization(&v8_flags.wasm_lazy_deserialization,
+                                       true);
+  WasmSerializationTest test;
+
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+
+  // The TurboFan code of the exported function is only materialized on its
+  // first call.
+  auto* native_module = module_object->native_module();
+  CHECK(native_module->HasDeferredDeserializedCode());
+  CHECK(!native_module->HasCode(2));
+
+  // Deserializing again hits the native module cache, instantiates the module
+  // and calls the exported function.
+  test.DeserializeAndRun();
+  CHECK(native_module->HasCodeWithTier(2, ExecutionTier::kTurbofan));
+  CHECK(!native_module->HasDeferredDeserializedCode());
+}
+
 TEST(SerializeLiftoffModuleFails) {
   // Make sure that no function is tiered up to TurboFan.
   if (!v8_flags.liftoff) return;
@@ -388,6 +411,100 @@ TEST(SerializeLiftoffModuleFails) {
   CHECK(!wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
 }
 
+TEST(SerializeLiftoffModuleWithoutTurbofanCode) {
+  // Make sure that no function is tiered up to TurboFan.
+  if (!v8_flags.liftoff) return;
+  FlagScope<bool> no_tier_up(&v8_flags.wasm_tier_up, false);
+  // Compile eagerly, so that deserialization waits for the executed functions
+  // to be compiled again.
+  FlagScope<bool> no_lazy_compilation(&v8_flags.wasm_lazy_compilation, false);
+  FlagScope<bool> allow_liftoff_only(
+      &v8_flags.wasm_serialize_without_turbofan_code, true);
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator, "test_zone");
+
+  CcTest::InitIsolateOnce();
+  ZoneBuffer wire_bytes_buffer(&zone);
+  WasmSerializationTest::BuildWireBytes(&zone, &wire_bytes_buffer);
+  ModuleWireBytes wire_bytes(wire_bytes_buffer.begin(),
+                             wire_bytes_buffer.end());
+
+  // Compile, run and serialize the module in a separate isolate, so that the
+  // deserialization below does not hit the native module cache.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* serialization_v8_isolate = v8::Isolate::New(create_params);
+  std::weak_ptr<NativeModule> weak_native_module;
+  std::unique_ptr<uint8_t[]> buffer;
+  size_t buffer_size;
+  {
+    v8::Isolate::Scope isolate_scope(serialization_v8_isolate);
+    v8::HandleScope scope(serialization_v8_isolate);
+    LocalContext env(serialization_v8_isolate);
+    Isolate* serialization_isolate =
+        reinterpret_cast<Isolate*>(serialization_v8_isolate);
+
+    ErrorThrower thrower(serialization_isolate, "Test");
+    Handle<WasmModuleObject> module_object =
+        GetWasmEngine()
+            ->SyncCompile(serialization_isolate, WasmEnabledFeatures::All(),
+                          CompileTimeImports{}, &thrower, wire_bytes)
+            .ToHandleChecked();
+    weak_native_module = module_object->shared_native_module();
+
+    // Only execute the exported function; functions 0 and 1 never run.
+    Handle<WasmInstanceObject> instance =
+        GetWasmEngine()
+            ->SyncInstantiate(serialization_isolate, &thrower, module_object,
+                              {}, {})
+            .ToHandleChecked();
+    Handle<Object> params[1] = {
+        handle(Smi::FromInt(41), serialization_isolate)};
+    CHECK_EQ(42, testing::CallWasmFunctionForTesting(
+                     serialization_isolate, instance,
+                     WasmSerializationTest::kFunctionName,
+                     base::ArrayVector(params)));
+
+    NativeModule* native_module = module_object->native_module();
+    CHECK(native_module->HasCodeWithTier(2, ExecutionTier::kLiftoff));
+    WasmSerializer wasm_serializer(native_module);
+    buffer_size = wasm_serializer.GetSerializedNativeModuleSize();
+    buffer.reset(new uint8_t[buffer_size]);
+    CHECK(wasm_serializer.SerializeNativeModule({buffer.get(), buffer_size}));
+  }
+  serialization_v8_isolate->Dispose();
+  // Busy-wait for the NativeModule to die, see
+  // {WasmSerializationTest::SetUp}.
+  while (weak_native_module.lock()) {
+  }
+
+  Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  Handle<WasmModuleObject> module_object;
+  CHECK(DeserializeNativeModule(isolate, {buffer.get(), buffer_size},
+                                base::VectorOf(wire_bytes.module_bytes()),
+                                CompileTimeImports{}, {})
+            .ToHandle(&module_object));
+
+  // The executed function is compiled with Liftoff again during
+  // deserialization, the other functions stay lazy.
+  NativeModule* native_module = module_object->native_module();
+  CHECK(!native_module->HasCode(0));
+  CHECK(!native_module->HasCode(1));
+  CHECK(native_module->HasCodeWithTier(2, ExecutionTier::kLiftoff));
+
+  ErrorThrower thrower(isolate, "Test");
+  Handle<WasmInstanceObject> instance =
+      GetWasmEngine()
+          ->SyncInstantiate(isolate, &thrower, module_object, {}, {})
+          .ToHandleChecked();
+  Handle<Object> params[1] = {handle(Smi::FromInt(41), isolate)};
+  CHECK_EQ(42, testing::CallWasmFunctionForTesting(
+                   isolate, instance, WasmSerializationTest::kFunctionName,
+                   base::ArrayVector(params)));
+}
+
 TEST(SerializeTieringBudget) {
   WasmSerializationTest test;
 
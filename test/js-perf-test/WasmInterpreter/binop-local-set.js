@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Statements of the form "x = a op b" compile to a binop followed by
+// local.set, which the Wasm interpreter fuses into a single instruction.
+
+new BenchmarkSuite('BinopLocalSet', [1000], [
+  new Benchmark('BinopLocalSet', false, false, 0, BinopLocalSet),
+]);
+
+// (func (export "run") (param $n i32) (result i32)
+//   (local $i i32) (local $a i32) (local $b i32)
+//   (loop
+//     (local.set $a (i32.add (local.get $a) (local.get $i)))
+//     (local.set $b (i32.xor (local.get $b)
+//                            (i32.mul (local.get $a) (i32.const 3))))
+//     (local.set $i (i32.add (local.get $i) (i32.const 1)))
+//     (br_if 0 (i32.lt_s (local.get $i) (local.get $n))))
+//   (i32.add (local.get $a) (local.get $b)))
+const kModuleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+  0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,  // type section
+  0x03, 0x02, 0x01, 0x00,                          // function section
+  0x07, 0x07, 0x01, 0x03, 0x72, 0x75, 0x6e,        // export section
+  0x00, 0x00,
+  0x0a, 0x2d, 0x01, 0x2b,                          // code section
+  0x01, 0x03, 0x7f,                                // locals
+  0x03, 0x40,                                      // loop
+  0x20, 0x02, 0x20, 0x01, 0x6a, 0x21, 0x02,        // a = a + i
+  0x20, 0x03, 0x20, 0x02, 0x41, 0x03, 0x6c,        // b = b ^ (a * 3)
+  0x73, 0x21, 0x03,
+  0x20, 0x01, 0x41, 0x01, 0x6a, 0x21, 0x01,        // i = i + 1
+  0x20, 0x01, 0x20, 0x00, 0x48, 0x0d, 0x00,        // br_if (i < n)
+  0x0b,                                            // end
+  0x20, 0x02, 0x20, 0x03, 0x6a,                    // a + b
+  0x0b,                                            // end
+]);
+
+const kIterations = 10000;
+const run = new WebAssembly.Instance(new WebAssembly.Module(kModuleBytes))
+                .exports.run;
+
+function Expected(n) {
+  let a = 0, b = 0, i = 0;
+  do {
+    a = (a + i) | 0;
+    b = b ^ Math.imul(a, 3);
+    i++;
+  } while (i < n);
+  return (a + b) | 0;
+}
+const kExpected = Expected(kIterations);
+
+function BinopLocalSet() {
+  if (run(kIterations) !== kExpected) throw new Error('Wrong result');
+}
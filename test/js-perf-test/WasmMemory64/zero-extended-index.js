@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Code ported from wasm32 to memory64 typically zero-extends its i32 indexes.
+// Such indexes are always covered by the guard regions of a memory64 without
+// a small maximum, so they don't need the check against the guard region size
+// that i64 indexes need. Both kernels sum the same memory; the difference in
+// score shows the cost of that check.
+
+new BenchmarkSuite('ZeroExtendedIndex', [1000], [
+  new Benchmark('ZeroExtendedIndex', false, false, 0, ZeroExtendedIndex),
+]);
+
+new BenchmarkSuite('I64Index', [1000], [
+  new Benchmark('I64Index', false, false, 0, I64Index),
+]);
+
+// (memory (export "mem") i64 1)
+// (func (export "zext") (param $n i32) (result i32)
+//   (local $i i32) (local $s i32)
+//   (loop
+//     (local.set $s (i32.add (local.get $s)
+//                            (i32.load (i64.extend_i32_u (local.get $i)))))
+//     (local.set $i (i32.add (local.get $i) (i32.const 4)))
+//     (br_if 0 (i32.lt_u (local.get $i) (local.get $n))))
+//   (local.get $s))
+// (func (export "i64") (param $n i32) (result i32)
+//   (local $i i64) (local $s i32)
+//   (loop
+//     (local.set $s (i32.add (local.get $s) (i32.load (local.get $i))))
+//     (local.set $i (i64.add (local.get $i) (i64.const 4)))
+//     (br_if 0 (i64.lt_u (local.get $i) (i64.extend_i32_u (local.get $n)))))
+//   (local.get $s))
+const kModuleBytes = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+  0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,  // type section
+  0x03, 0x03, 0x02, 0x00, 0x00,                    // function section
+  0x05, 0x03, 0x01, 0x04, 0x01,                    // memory section
+  0x07, 0x14, 0x03,                                // export section
+  0x04, 0x7a, 0x65, 0x78, 0x74, 0x00, 0x00,        // "zext"
+  0x03, 0x69, 0x36, 0x34, 0x00, 0x01,              // "i64"
+  0x03, 0x6d, 0x65, 0x6d, 0x02, 0x00,              // "mem"
+  0x0a, 0x49, 0x02,                                // code section
+  0x22, 0x01, 0x02, 0x7f,                          // "zext" locals
+  0x03, 0x40,                                      // loop
+  0x20, 0x02, 0x20, 0x01, 0xad, 0x28, 0x02, 0x00,  // s = s + load(zext(i))
+  0x6a, 0x21, 0x02,
+  0x20, 0x01, 0x41, 0x04, 0x6a, 0x21, 0x01,        // i = i + 4
+  0x20, 0x01, 0x20, 0x00, 0x49, 0x0d, 0x00,        // br_if (i < n)
+  0x0b,                                            // end
+  0x20, 0x02,                                      // s
+  0x0b,                                            // end
+  0x24, 0x02, 0x01, 0x7e, 0x01, 0x7f,              // "i64" locals
+  0x03, 0x40,                                      // loop
+  0x20, 0x02, 0x20, 0x01, 0x28, 0x02, 0x00,        // s = s + load(i)
+  0x6a, 0x21, 0x02,
+  0x20, 0x01, 0x42, 0x04, 0x7c, 0x21, 0x01,        // i = i + 4
+  0x20, 0x01, 0x20, 0x00, 0xad, 0x54, 0x0d, 0x00,  // br_if (i < zext(n))
+  0x0b,                                            // end
+  0x20, 0x02,                                      // s
+  0x0b,                                            // end
+]);
+
+const kBytes = 0x10000;
+const {zext, i64, mem} =
+    new WebAssembly.Instance(new WebAssembly.Module(kModuleBytes)).exports;
+
+const kValues = new Int32Array(mem.buffer);
+let kExpected = 0;
+for (let i = 0; i < kValues.length; i++) {
+  kValues[i] = i * 7;
+  kExpected = (kExpected + kValues[i]) | 0;
+}
+
+function ZeroExtendedIndex() {
+  if (zext(kBytes) !== kExpected) throw new Error('Wrong result');
+}
+
+function I64Index() {
+  if (i64(kBytes) !== kExpected) throw new Error('Wrong result');
+}
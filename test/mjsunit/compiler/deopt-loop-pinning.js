@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --deopt-loop-pinning --no-maglev
+
+function load(o) {
+  return o.x;
+}
+
+%PrepareFunctionForOptimization(load);
+assertEquals(1, load({x: 1}));
+assertEquals(1, load({x: 1}));
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load({x: 1}));
+assertOptimized(load);
+
+// First deopt at the property load records the site.
+assertEquals(2, load({a: 0, x: 2}));
+assertUnoptimized(load);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(2, load({a: 0, x: 2}));
+assertOptimized(load);
+
+// A second deopt at the same site for the same reason pins the load to its
+// generic state.
+assertEquals(3, load({b: 0, x: 3}));
+assertUnoptimized(load);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(3, load({b: 0, x: 3}));
+assertOptimized(load);
+
+// The re-optimized code no longer speculates on the receiver map.
+assertEquals(4, load({c: 0, x: 4}));
+assertEquals(5, load({d: 0, x: 5}));
+assertOptimized(load);
+
+// Deopts alternating between two sites don't pin either of them.
+function load2(o, p) {
+  return o.x + p.y;
+}
+
+%PrepareFunctionForOptimization(load2);
+assertEquals(2, load2({x: 1}, {y: 1}));
+assertEquals(2, load2({x: 1}, {y: 1}));
+%OptimizeFunctionOnNextCall(load2);
+assertEquals(2, load2({x: 1}, {y: 1}));
+assertOptimized(load2);
+
+assertEquals(2, load2({a: 0, x: 1}, {y: 1}));
+assertUnoptimized(load2);
+%OptimizeFunctionOnNextCall(load2);
+assertEquals(2, load2({a: 0, x: 1}, {y: 1}));
+assertOptimized(load2);
+
+assertEquals(2, load2({x: 1}, {b: 0, y: 1}));
+assertUnoptimized(load2);
+%OptimizeFunctionOnNextCall(load2);
+assertEquals(2, load2({x: 1}, {b: 0, y: 1}));
+assertOptimized(load2);
+
+// The load of o.x still speculates on the receiver map.
+assertEquals(2, load2({c: 0, x: 1}, {y: 1}));
+assertUnoptimized(load2);
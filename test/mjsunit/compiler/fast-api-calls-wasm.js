@@ -44,6 +44,14 @@ function buildWasm(name, sig, body) {
       [kWasmI32],
     ),
   );
+  const overloaded_add_all_32bit_int_5args = builder.addImport(
+    'fast_c_api',
+    'overloaded_add_all_32bit_int_5args',
+    makeSig(
+      [kWasmI32, kWasmI32, kWasmI32, kWasmI32, kWasmI32],
+      [kWasmI32],
+    ),
+  );
   const test_wasm_memory = builder.addImport(
     'fast_c_api',
     'test_wasm_memory',
@@ -61,6 +69,7 @@ function buildWasm(name, sig, body) {
         add_all_no_options_mismatch,
         add_all_nested_bound,
         overloaded_add_all_32bit_int,
+        overloaded_add_all_32bit_int_5args,
         test_wasm_memory,
         throw_no_fallback
       }))
@@ -75,6 +84,7 @@ function buildWasm(name, sig, body) {
         .bind(fast_c_api)
         .bind(x),
       overloaded_add_all_32bit_int: fast_c_api.overloaded_add_all_32bit_int_no_sig.bind(fast_c_api),
+      overloaded_add_all_32bit_int_5args: fast_c_api.overloaded_add_all_32bit_int_no_sig.bind(fast_c_api),
       test_wasm_memory: fast_c_api.test_wasm_memory.bind(fast_c_api),
       throw_no_fallback: fast_c_api.throw_no_fallback.bind(fast_c_api),
     },
@@ -187,6 +197,26 @@ assertEquals(overload_result, overloaded_add_all_32bit_int_wasm());
 assertEquals(1, fast_c_api.fast_call_count());
 assertEquals(0, fast_c_api.slow_call_count());
 
+// The import signature matches the second (5 argument) overload.
+const overloaded_add_all_32bit_int_5args_wasm = buildWasm(
+  'overloaded_add_all_32bit_int_5args_wasm', makeSig([], [kWasmI32]),
+  ({ overloaded_add_all_32bit_int_5args }) => [
+    ...wasmI32Const(1),
+    ...wasmI32Const(2),
+    ...wasmI32Const(3),
+    ...wasmI32Const(4),
+    ...wasmI32Const(5),
+    kExprCallFunction, overloaded_add_all_32bit_int_5args,
+    kExprReturn,
+  ],
+);
+
+// Test wasm hits fast path.
+fast_c_api.reset_counts();
+assertEquals(1 + 2 + 3 + 4 + 5, overloaded_add_all_32bit_int_5args_wasm());
+assertEquals(1, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
 // ------------- Test test_wasm_memory ---------------
 const test_wasm_memory_wasm = buildWasm(
   'test_wasm_memory_wasm', makeSig([], [kWasmI32]),
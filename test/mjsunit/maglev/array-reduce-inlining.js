@@ -0,0 +1,75 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-inline-array-reduce
+
+function sum(a) {
+  return a.reduce((acc, v) => acc + v, 0);
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(6, sum([1, 2, 3]));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(0, sum([]));
+assertEquals(10, sum([1, 2, 3, 4]));
+
+// Holes are skipped and leave the accumulator untouched.
+function holey_sum(a) {
+  return a.reduce((acc, v) => acc + v, 100);
+}
+
+%PrepareFunctionForOptimization(holey_sum);
+assertEquals(103, holey_sum([1, , 2]));
+assertEquals(103, holey_sum([1, , 2]));
+%OptimizeMaglevOnNextCall(holey_sum);
+assertEquals(103, holey_sum([1, , 2]));
+assertEquals(100, holey_sum([, , ]));
+
+// Transitioning the elements kind in the callback deopts and continues in the
+// builtin with the current accumulator.
+let change_elements = false;
+
+function maybe_change_elements(a) {
+  if (change_elements) {
+    let old = a[1];
+    a[1] = 0.5;
+    a[1] = old;
+  }
+}
+
+function transitioning_sum(a) {
+  return a.reduce((acc, v) => {
+    maybe_change_elements(a);
+    return acc + v;
+  }, 0);
+}
+
+%NeverOptimizeFunction(maybe_change_elements);
+%PrepareFunctionForOptimization(transitioning_sum);
+assertEquals(3, transitioning_sum([0, 1, 2]));
+assertEquals(3, transitioning_sum([0, 1, 2]));
+%OptimizeMaglevOnNextCall(transitioning_sum);
+assertEquals(3, transitioning_sum([0, 1, 2]));
+change_elements = true;
+assertEquals(3, transitioning_sum([0, 1, 2]));
+
+// A callback that is not a constant is called with a check on the call target
+// feedback. Failing that check deopts eagerly to before the reduce call.
+function reduce_with(a, callback) {
+  return a.reduce(callback, 1);
+}
+
+const add = (acc, v) => acc + v;
+const mul = (acc, v) => acc * v;
+
+%PrepareFunctionForOptimization(reduce_with);
+assertEquals(7, reduce_with([1, 2, 3], add));
+assertEquals(7, reduce_with([1, 2, 3], add));
+%OptimizeMaglevOnNextCall(reduce_with);
+assertEquals(7, reduce_with([1, 2, 3], add));
+assertEquals(24, reduce_with([2, 3, 4], mul));
+assertEquals(11, reduce_with([1, 2, 3, 4], add));
+assertThrows(() => reduce_with([1], 42), TypeError);
@@ -0,0 +1,34 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-inlining
+// Flags: --maglev-polymorphic-inlining --no-always-turbofan
+
+class A { get() { return 1; } }
+class B { get() { return 2; } }
+class C { get() { return this.x; } constructor() { this.x = 3; } }
+
+function callGet(o) {
+  return o.get();
+}
+
+const a = new A();
+const b = new B();
+const c = new C();
+
+%PrepareFunctionForOptimization(callGet);
+assertEquals(1, callGet(a));
+assertEquals(2, callGet(b));
+assertEquals(3, callGet(c));
+
+%OptimizeMaglevOnNextCall(callGet);
+assertEquals(1, callGet(a));
+assertEquals(2, callGet(b));
+assertEquals(3, callGet(c));
+assertTrue(isMaglevved(callGet));
+
+// Changing the method of one of the classes must not be missed.
+C.prototype.get = function() { return 4; };
+assertEquals(4, callGet(c));
+assertEquals(1, callGet(a));
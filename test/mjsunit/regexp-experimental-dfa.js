@@ -0,0 +1,96 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-dfa
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+// Match bounds follow the priorities of a backtracking engine.
+Test(/asdf|123/, "xyz123asdf", ["123"], 0);
+Test(/asdf|123|fj|f|a/, "da123", ["a"], 0);
+Test(/x*[xa]/, "xxaa", ["xxa"], 0);
+Test(/x*?[xa]/, "xxaa", ["x"], 0);
+Test(/x+?[ax]/, "axxa", ["xx"], 0);
+Test(/xx??[xa]/, "xxaa", ["xx"], 0);
+Test(/x{2,4}?/, "xxxxxxxxx", ["xx"], 0);
+Test(/a|ab/, "xab", ["a"], 0);
+Test(/ab|a/, "xab", ["ab"], 0);
+Test(/(?:a|ab)(?:c|bcd)/, "abcd", ["abcd"], 0);
+Test(/a*b|a/, "aaac", ["a"], 0);
+Test(/(?:x|xy)*z/, "xyxyxxz", ["xyxyxxz"], 0);
+Test(/asdf(?:[0-9]|(?:xy|x)*)*/, "kkkasdf5xyx8xyyky", ["asdf5xyx8xy"], 0);
+
+// Empty matches.
+Test(new RegExp(""), "asdf", [""], 0);
+Test(/x*/, "asdfxk", [""], 0);
+Test(/(?:)*a/, "ba", ["a"], 0);
+
+// No match.
+Test(/abc/, "ababab", null, 0);
+Test(/a[bc]d/, "", null, 0);
+
+// Captures are computed from the match found by the DFA.
+Test(/(123|xyz)/, "asdf123", ["123", "123"], 0);
+Test(/(123)|(xyz)/, "..xyz", ["xyz", undefined, "xyz"], 0);
+Test(/(?:(123)|(xyz))*/, "xyz123", ["xyz123", "123", undefined], 0);
+Test(/(a+)(b*)c/, "aabaabbc", ["aabbc", "aa", "bb"], 0);
+
+// Two-byte subjects.
+Test(/쁰d섊/, "123쁰d섊abc", ["쁰d섊"], 0);
+Test(/[^a]b/, "aab섊bab", ["섊b"], 0);
+Test(/[Ā-ſ]+/, "abcĀāĂdef", ["ĀāĂ"], 0);
+
+// Sticky and global regexps start at lastIndex.
+{
+  const re = /a+/y;
+  re.lastIndex = 1;
+  Test(re, "baab", ["aa"], 3);
+  Test(re, "baab", null, 0);
+
+  const global = /a+|b/g;
+  global.lastIndex = 2;
+  Test(global, "aaabaa", ["a"], 3);
+  Test(global, "aaabaa", ["b"], 4);
+  assertEquals(["aaa", "b", "aa"], "aaabaa".match(/a+|b/g));
+  assertEquals(["", "", "", ""], "abc".match(/x*/g));
+  assertEquals("<aa>b<a>c", "aabac".replace(/a+/g, "<$&>"));
+}
+
+// Long subjects with and without a match near the end.
+{
+  const subject = "x".repeat(100000);
+  Test(/xy|yx/, subject, null, 0);
+  Test(/xy|yx/, subject + "y", ["xy"], 0);
+  assertEquals(100000, (subject + "yxx").search(/yx+|y/));
+}
+
+// Patterns with many DFA states exhaust the state cache, so the search falls
+// back to the NFA.
+{
+  let subject = "";
+  let seed = 42;
+  for (let i = 0; i < 20000; ++i) {
+    seed = (Math.imul(seed, 1103515245) + 12345) | 0;
+    subject += seed & 0x10000 ? "a" : "b";
+  }
+  subject += "a" + "b".repeat(14) + "c";
+  const re = /a[ab]{14}c/;
+  assertEquals(subject.length - 16, subject.search(re));
+  assertEquals(-1, subject.slice(0, -1).search(re));
+}
+
+// Assertions and lookbehinds are not supported by the DFA and still work.
+Test(/^ab|b$/, "abab", ["ab"], 0);
+Test(/\bb/, "ab b", ["b"], 0);
+Test(/(?<=a)b/, "bab", ["b"], 0);
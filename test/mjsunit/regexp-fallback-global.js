@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-experimental-regexp-engine-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-fallback=100
+// Flags: --experimental-regexp-engine-dfa
+
+// Global regexps with catastrophic backtracking fall back to the experimental
+// engine for the batches of matches that need it, and go back to irregexp for
+// the others.  All matches have to be reported as if irregexp had found them.
+
+(function TestNestedQuantifiers() {
+  const chunk = "a".repeat(30) + "cab";
+  const subject = chunk.repeat(50);
+  const matches = subject.match(/(?:a+)+b/g);
+  assertEquals(50, matches.length);
+  for (const match of matches) assertEquals("ab", match);
+
+  let indices = [];
+  subject.replace(/(a+)+b/g, (match, capture, index) => {
+    assertEquals("ab", match);
+    assertEquals("a", capture);
+    indices.push(index);
+    return "";
+  });
+  assertEquals(50, indices.length);
+  for (let i = 0; i < indices.length; ++i) {
+    assertEquals(i * chunk.length + 31, indices[i]);
+  }
+})();
+
+(function TestAlternativesAfterFallback() {
+  const subject = ("x".repeat(25) + "z").repeat(20) + "xxy";
+  const matches = subject.match(/(?:x+x+)+y|z/g);
+  assertEquals(21, matches.length);
+  for (let i = 0; i < 20; ++i) assertEquals("z", matches[i]);
+  assertEquals("xxy", matches[20]);
+  assertEquals("", subject.replace(/(?:x+x+)+y|z|x/g, ""));
+})();
+
+(function TestEmptyMatchesAfterFallback() {
+  // Every position backtracks excessively before matching the empty string.
+  const subject = "a".repeat(30) + "d";
+  const matches = subject.match(/(?:a+)+c|/g);
+  assertEquals(subject.length + 1, matches.length);
+  for (const match of matches) assertEquals("", match);
+  assertEquals(subject.split(""), subject.split(/(?:a+)+c|/));
+})();
+
+(function TestCheapMatchesAfterFallback() {
+  // Only the first match backtracks excessively.
+  const subject = "a".repeat(30) + "cab" + "ab".repeat(200);
+  const matches = subject.match(/(?:a+)+b/g);
+  assertEquals(201, matches.length);
+  for (const match of matches) assertEquals("ab", match);
+  assertEquals("a".repeat(30) + "c", subject.replace(/(?:a+)+b/g, ""));
+})();
+
+(function TestRepeatedCalls() {
+  const re = /(?:a+)+b/g;
+  const subject = "a".repeat(30) + "cab";
+  for (let i = 0; i < 5; ++i) {
+    assertEquals(["ab"], subject.match(re));
+    assertEquals(0, re.lastIndex);
+  }
+})();
@@ -0,0 +1,53 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up --no-regexp-interpret-all
+
+// Patterns whose only interesting lookahead position holds a single character
+// are skipped to that character with a vectorized scan, falling back to a
+// scalar loop near the end of the subject.
+
+function check(re, subject, expected_index) {
+  re.lastIndex = 0;
+  const result = re.exec(subject);
+  if (expected_index < 0) {
+    assertNull(result, `${re} on length ${subject.length}`);
+  } else {
+    assertNotNull(result, `${re} on length ${subject.length}`);
+    assertEquals(expected_index, result.index, `${re}`);
+  }
+}
+
+(function TestSingleCharacter() {
+  const filler = 'abcdefghijklmnop'.repeat(8);
+  for (let length of [0, 1, 15, 16, 17, 31, 32, 33, 100]) {
+    const prefix = filler.substring(0, length);
+    for (let tail of ['', 'z', 'zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz']) {
+      check(/q/, prefix + 'q' + tail, length);
+      check(/q\d/, prefix + 'q1' + tail, length);
+      check(/q\d/, prefix + 'qq' + tail + 'q7', length + 2 + tail.length);
+      check(/q/, prefix + tail, -1);
+      // Characters which alias 'q' in the 128-entry skip table.
+      check(/q/, prefix + '\xf1' + tail, -1);
+      check(/q/g, prefix + '\xf1q' + tail, length + 1);
+    }
+  }
+})();
+
+(function TestTwoByteSubject() {
+  const filler = 'ሴbcdefghijklmno'.repeat(8);
+  for (let length of [0, 7, 8, 9, 15, 16, 17, 100]) {
+    const prefix = filler.substring(0, length);
+    check(/q/, prefix + 'q', length);
+    check(/q/, prefix + 'ቱ', -1);
+    check(/ቱ/, prefix + 'ቱ', length);
+  }
+})();
+
+(function TestGlobalMatches() {
+  const subject = ('x'.repeat(40) + 'q').repeat(10);
+  assertEquals(10, subject.match(/q/g).length);
+  assertEquals(10, subject.split(/q/).length - 1);
+  assertEquals(subject.replace(/q/g, 'r'), subject.replaceAll('q', 'r'));
+})();
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --turboshaft-typed-array-loop-unrolling
+
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i];
+  }
+  return s;
+}
+
+function dot(a, b) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i] * b[i];
+  }
+  return s;
+}
+
+function scale(a, out, k) {
+  for (let i = 0; i < a.length; i++) {
+    out[i] = a[i] * k + 1;
+  }
+}
+
+// Lengths around the unroll count make sure that the remainder iterations of
+// partially unrolled loops are executed.
+const kLengths = [0, 1, 2, 3, 4, 5, 7, 8, 9, 31, 100];
+
+function check() {
+  for (let len of kLengths) {
+    const f = new Float64Array(len);
+    const i32 = new Int32Array(len);
+    let expected_sum = 0;
+    let expected_dot = 0;
+    for (let i = 0; i < len; i++) {
+      f[i] = i + 0.5;
+      i32[i] = 3 * i - 7;
+      expected_sum += f[i];
+      expected_dot += f[i] * i32[i];
+    }
+    assertEquals(expected_sum, sum(f));
+    assertEquals(expected_dot, dot(f, i32));
+    const out = new Float64Array(len);
+    scale(f, out, 2);
+    for (let i = 0; i < len; i++) {
+      assertEquals(f[i] * 2 + 1, out[i]);
+    }
+  }
+}
+
+%PrepareFunctionForOptimization(sum);
+%PrepareFunctionForOptimization(dot);
+%PrepareFunctionForOptimization(scale);
+check();
+%OptimizeFunctionOnNextCall(sum);
+%OptimizeFunctionOnNextCall(dot);
+%OptimizeFunctionOnNextCall(scale);
+check();
+assertOptimized(sum);
+assertOptimized(dot);
+assertOptimized(scale);
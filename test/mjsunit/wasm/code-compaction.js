@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-code-compaction --stress-wasm-code-gc
+// Flags: --liftoff --no-wasm-lazy-compilation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumFunctions = 20;
+
+function buildModule() {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 2);
+  const funcs = [];
+  // f0(x) = mem[x] + x; f_i(x) = f_{i-1}(x + 4) * 3 + i.
+  funcs.push(builder.addFunction('f0', kSig_i_i).addBody([
+    kExprLocalGet, 0, kExprI32LoadMem, 0, 0, kExprLocalGet, 0, kExprI32Add
+  ]));
+  for (let i = 1; i < kNumFunctions; ++i) {
+    funcs.push(builder.addFunction('f' + i, kSig_i_i).addBody([
+      kExprLocalGet, 0, kExprI32Const, 4, kExprI32Add,
+      kExprCallFunction, funcs[i - 1].index,
+      kExprI32Const, 3, kExprI32Mul, ...wasmI32Const(i), kExprI32Add
+    ]));
+  }
+  for (const func of funcs) func.exportFunc();
+  // Calls a runtime stub.
+  builder.addFunction('grow', kSig_i_v)
+      .addBody([kExprI32Const, 0, kExprMemoryGrow, 0])
+      .exportFunc();
+  return builder.instantiate();
+}
+
+function expected(i, x) {
+  if (i == 0) return x;  // Memory is zero-initialized.
+  return (expected(i - 1, x + 4) * 3 + i) | 0;
+}
+
+(function TestCodeStaysCorrectWhileTieringUp() {
+  print(arguments.callee.name);
+  const instance = buildModule();
+  const exports = instance.exports;
+  for (let round = 0; round < 3; ++round) {
+    for (let i = 0; i < kNumFunctions; ++i) {
+      // Replace Liftoff code, which makes the code GC free it and move the
+      // remaining code into the freed space.
+      if (round == 1) %WasmTierUpFunction(exports['f' + i]);
+      for (let j = 0; j < kNumFunctions; ++j) {
+        assertEquals(expected(j, round), exports['f' + j](round));
+      }
+      assertEquals(1, exports.grow());
+    }
+  }
+  assertTraps(kTrapMemOutOfBounds, () => exports.f0(-4));
+})();
+
+(function TestTurbofanCodeIsRelocated() {
+  print(arguments.callee.name);
+  const instance = buildModule();
+  const exports = instance.exports;
+  // The Turbofan code is allocated above the eagerly compiled Liftoff code,
+  // which becomes dead and is freed by the next code GC.
+  for (let i = 0; i < kNumFunctions; ++i) {
+    %WasmTierUpFunction(exports['f' + i]);
+  }
+  // The code GC finishes asynchronously once the isolate reported its live
+  // code on the next interrupt check, so keep running code until the freed
+  // space allows moving code.
+  let relocated = 0;
+  for (let attempt = 0; attempt < 100 && relocated == 0; ++attempt) {
+    for (let j = 0; j < kNumFunctions; ++j) {
+      assertEquals(expected(j, attempt), exports['f' + j](attempt));
+    }
+    relocated = %WasmCompactCode(instance);
+  }
+  assertTrue(relocated > 0);
+  // The moved code is still correct, including calls and runtime stub calls.
+  for (let j = 0; j < kNumFunctions; ++j) {
+    assertTrue(%IsTurboFanFunction(exports['f' + j]));
+    assertEquals(expected(j, 7), exports['f' + j](7));
+  }
+  assertEquals(1, exports.grow());
+  assertTraps(kTrapMemOutOfBounds, () => exports.f0(-4));
+})();
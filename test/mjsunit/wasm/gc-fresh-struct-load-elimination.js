@@ -0,0 +1,133 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turboshaft-wasm --no-liftoff --wasm-opt
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function TestFieldsSurviveUnrelatedCall() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const struct = builder.addStruct(
+      [makeField(kWasmI32, true), makeField(kWasmI32, true)]);
+  const sideEffect = builder.addImport('m', 'sideEffect', kSig_v_v);
+  builder.addFunction('sum', makeSig([kWasmI32, kWasmI32], [kWasmI32]))
+      .addLocals(wasmRefType(struct), 1)
+      .addBody([
+        kExprLocalGet, 0, kExprLocalGet, 1,
+        kGCPrefix, kExprStructNew, struct,
+        kExprLocalSet, 2,
+        // The call cannot see the struct, so the fields can be forwarded.
+        kExprCallFunction, sideEffect,
+        kExprLocalGet, 2, kGCPrefix, kExprStructGet, struct, 0,
+        kExprLocalGet, 2, kGCPrefix, kExprStructGet, struct, 1,
+        kExprI32Add,
+      ])
+      .exportFunc();
+  let calls = 0;
+  const instance = builder.instantiate({m: {sideEffect: () => ++calls}});
+  assertEquals(42, instance.exports.sum(40, 2));
+  assertEquals(-1, instance.exports.sum(0, -1));
+  assertEquals(2, calls);
+})();
+
+(function TestEscapingStructIsReloaded() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const struct = builder.addStruct([makeField(kWasmI32, true)]);
+  const escape = builder.addImport(
+      'm', 'escape', makeSig([kWasmExternRef], []));
+  const poke = builder.addImport('m', 'poke', kSig_v_v);
+  const setter = builder.addFunction('set', makeSig([wasmRefType(struct)], []))
+      .addBody([
+        kExprLocalGet, 0, kExprI32Const, 7,
+        kGCPrefix, kExprStructSet, struct, 0,
+      ]);
+  builder.addGlobal(wasmRefNullType(struct), true, false);
+  builder.addFunction('viaCall', kSig_i_v)
+      .addLocals(wasmRefType(struct), 1)
+      .addBody([
+        kExprI32Const, 1, kGCPrefix, kExprStructNew, struct,
+        kExprLocalTee, 0,
+        // Passed to the call: the field must be reloaded.
+        kExprCallFunction, setter.index,
+        kExprLocalGet, 0, kGCPrefix, kExprStructGet, struct, 0,
+      ])
+      .exportFunc();
+  builder.addFunction('viaGlobal', kSig_i_v)
+      .addLocals(wasmRefType(struct), 1)
+      .addBody([
+        kExprI32Const, 1, kGCPrefix, kExprStructNew, struct,
+        kExprLocalTee, 0,
+        kExprGlobalSet, 0,
+        // Stored to a global and then handed out by the import.
+        kExprGlobalGet, 0, kGCPrefix, kExprExternConvertAny,
+        kExprCallFunction, escape,
+        kExprCallFunction, poke,
+        kExprLocalGet, 0, kGCPrefix, kExprStructGet, struct, 0,
+      ])
+      .exportFunc();
+  builder.addFunction('setExternal', makeSig([kWasmExternRef], []))
+      .addBody([
+        kExprLocalGet, 0, kGCPrefix, kExprAnyConvertExtern,
+        kGCPrefix, kExprRefCast, struct,
+        kExprCallFunction, setter.index,
+      ])
+      .exportFunc();
+  let escaped = null;
+  const instance = builder.instantiate({m: {
+    escape: (s) => escaped = s,
+    poke: () => instance.exports.setExternal(escaped),
+  }});
+  assertEquals(7, instance.exports.viaCall());
+  assertEquals(7, instance.exports.viaGlobal());
+})();
+
+(function TestTypeCheckOnFreshStruct() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const struct = builder.addStruct([makeField(kWasmI32, true)]);
+  const sideEffect = builder.addImport('m', 'sideEffect', kSig_v_v);
+  builder.addFunction('test', kSig_i_i)
+      .addLocals(wasmRefNullType(struct), 1)
+      .addBody([
+        kExprLocalGet, 0, kGCPrefix, kExprStructNew, struct,
+        kExprLocalTee, 1,
+        kExprRefIsNull,
+        kExprLocalGet, 1, kGCPrefix, kExprRefTest, struct,
+        kExprI32Add,
+        kExprCallFunction, sideEffect,
+        kExprLocalGet, 1, kGCPrefix, kExprStructGet, struct, 0,
+        kExprI32Add,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate({m: {sideEffect: () => {}}});
+  assertEquals(11, instance.exports.test(10));
+})();
+
+(function TestStructEscapingThroughThrowIsReloaded() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const struct = builder.addStruct([makeField(kWasmI32, true)]);
+  const tag = builder.addTag(makeSig([wasmRefType(struct)], []));
+  builder.addFunction('test', kSig_i_v)
+      .addLocals(wasmRefType(struct), 2)
+      .addBody([
+        kExprI32Const, 1, kGCPrefix, kExprStructNew, struct,
+        kExprLocalSet, 0,
+        kExprTry, kWasmRef, struct,
+          // The exception stores the struct into its values array.
+          kExprLocalGet, 0, kExprThrow, tag,
+        kExprCatch, tag,
+        kExprEnd,
+        kExprLocalSet, 1,
+        // Write through the caught reference, then read the original local.
+        kExprLocalGet, 1, kExprI32Const, 7,
+        kGCPrefix, kExprStructSet, struct, 0,
+        kExprLocalGet, 0, kGCPrefix, kExprStructGet, struct, 0,
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(7, instance.exports.test());
+})();
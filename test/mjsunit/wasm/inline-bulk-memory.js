@@ -0,0 +1,90 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turboshaft-wasm --wasm-inline-bulk-memory --no-liftoff
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Sizes around the 128-bit, 64-bit and 32-bit chunk boundaries, up to the
+// largest size that is lowered inline, plus one size that still uses the call.
+const kSizes = [1, 2, 3, 4, 7, 8, 15, 16, 17, 31, 33, 48, 63, 64, 65];
+
+function buildModule(sizes) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1);
+  builder.exportMemoryAs('memory');
+  for (const size of sizes) {
+    builder.addFunction('copy' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0, kExprLocalGet, 1, ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryCopy, 0, 0
+        ])
+        .exportFunc();
+    builder.addFunction('fill' + size, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0, kExprLocalGet, 1, ...wasmI32Const(size),
+          kNumericPrefix, kExprMemoryFill, 0
+        ])
+        .exportFunc();
+  }
+  return builder.instantiate();
+}
+
+const instance = buildModule(kSizes);
+const view = new Uint8Array(instance.exports.memory.buffer);
+
+function reset() {
+  for (let i = 0; i < view.length; ++i) view[i] = i * 7;
+}
+
+(function TestCopy() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    const copy = instance.exports['copy' + size];
+    for (const [dst, src] of [[1000, 2000], [1003, 2001], [1000, 1005],
+                              [1005, 1000]]) {
+      reset();
+      const expected = view.slice();
+      expected.copyWithin(dst, src, src + size);
+      copy(dst, src);
+      assertEquals(expected, view, `copy${size}(${dst}, ${src})`);
+    }
+  }
+})();
+
+(function TestFill() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    const fill = instance.exports['fill' + size];
+    for (const [dst, value] of [[1000, 0], [1003, 0xab], [1001, 0x1ff]]) {
+      reset();
+      const expected = view.slice();
+      expected.fill(value & 0xff, dst, dst + size);
+      fill(dst, value);
+      assertEquals(expected, view, `fill${size}(${dst}, ${value})`);
+    }
+  }
+})();
+
+(function TestOutOfBoundsDoesNotWrite() {
+  print(arguments.callee.name);
+  for (const size of kSizes) {
+    const copy = instance.exports['copy' + size];
+    const fill = instance.exports['fill' + size];
+    reset();
+    const expected = view.slice();
+    // The last byte is out of bounds.
+    const dst = kPageSize - size + 1;
+    assertTraps(kTrapMemOutOfBounds, () => copy(dst, 0));
+    assertTraps(kTrapMemOutOfBounds, () => copy(0, dst));
+    assertTraps(kTrapMemOutOfBounds, () => fill(dst, 0x42));
+    assertTraps(kTrapMemOutOfBounds, () => copy(-1, 0));
+    assertTraps(kTrapMemOutOfBounds, () => fill(-1, 0x42));
+    assertEquals(expected, view);
+    // Exactly at the end is fine.
+    copy(kPageSize - size, 0);
+    fill(kPageSize - size, 0x42);
+    assertEquals(0x42, view[kPageSize - 1]);
+  }
+})();
@@ -0,0 +1,138 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff --no-wasm-tier-up
+// Flags: --no-wasm-lazy-compilation --liftoff-loop-locals-in-registers
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testSumLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // sum(n): s = 0; i = 0; do { s += i; i++ } while (i < n); return s.
+  builder.addFunction('sum', kSig_i_i)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprI32Const, 0, kExprLocalSet, 1,
+        kExprI32Const, 0, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 1,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(0, instance.exports.sum(1));
+  assertEquals(4950, instance.exports.sum(100));
+  assertEquals(499500, instance.exports.sum(1000));
+})();
+
+(function testNestedLoopsWithFloats() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Computes sum_{i<n} sum_{j<n} (i * j) as f64.
+  builder.addFunction('nested', makeSig([kWasmI32], [kWasmF64]))
+      .addLocals(kWasmI32, 2)
+      .addLocals(kWasmF64, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprI32Const, 0, kExprLocalSet, 2,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 3,
+            kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Mul,
+            kExprF64SConvertI32, kExprF64Add, kExprLocalSet, 3,
+            kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+            kExprLocalGet, 0, kExprI32LtS,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 1, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 1,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  function expected(n) {
+    let result = 0;
+    for (let i = 0; i < n; ++i) {
+      for (let j = 0; j < n; ++j) result += i * j;
+    }
+    return result;
+  }
+  for (const n of [1, 2, 10, 57]) {
+    assertEquals(expected(n), instance.exports.nested(n));
+  }
+})();
+
+(function testManyLocalsAcrossLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // More locals than cache registers: all of them are live in registers before
+  // the loop and get rotated in the loop body.
+  const kNumLocals = 24;
+  const body = [];
+  for (let i = 0; i < kNumLocals; ++i) {
+    body.push(kExprI32Const, i + 1, kExprLocalSet, i + 1);
+  }
+  body.push(kExprLoop, kWasmVoid);
+  // local[k] += local[k + 1] for all k, then decrement the counter.
+  for (let i = 1; i < kNumLocals; ++i) {
+    body.push(
+        kExprLocalGet, i, kExprLocalGet, i + 1, kExprI32Add, kExprLocalSet, i);
+  }
+  body.push(
+      kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+      kExprBrIf, 0, kExprEnd);
+  for (let i = 1; i <= kNumLocals; ++i) {
+    body.push(kExprLocalGet, i);
+    if (i > 1) body.push(kExprI32Add);
+  }
+  builder.addFunction('many', kSig_i_i)
+      .addLocals(kWasmI32, kNumLocals)
+      .addBody(body)
+      .exportFunc();
+  const instance = builder.instantiate();
+  function expected(n) {
+    const locals = [];
+    for (let i = 0; i < kNumLocals; ++i) locals.push(i + 1);
+    do {
+      for (let i = 0; i < kNumLocals - 1; ++i) {
+        locals[i] = (locals[i] + locals[i + 1]) | 0;
+      }
+    } while (--n);
+    return locals.reduce((a, b) => (a + b) | 0);
+  }
+  for (const n of [1, 3, 17]) {
+    assertEquals(expected(n), instance.exports.many(n));
+  }
+})();
+
+(function testI64Locals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Fibonacci with i64 locals.
+  builder.addFunction('fib', makeSig([kWasmI32], [kWasmI64]))
+      .addLocals(kWasmI64, 3)
+      .addBody([
+        kExprI64Const, 1, kExprLocalSet, 2,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprI64Add, kExprLocalSet, 3,
+          kExprLocalGet, 2, kExprLocalSet, 1,
+          kExprLocalGet, 3, kExprLocalSet, 2,
+          kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertEquals(1n, instance.exports.fib(1));
+  assertEquals(55n, instance.exports.fib(10));
+  assertEquals(12586269025n, instance.exports.fib(50));
+})();
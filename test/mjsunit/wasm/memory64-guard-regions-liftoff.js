@@ -0,0 +1,8 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-multi-memory --experimental-wasm-memory64
+// Flags: --liftoff --no-wasm-tier-up
+
+d8.file.execute('test/mjsunit/wasm/memory64-guard-regions.js');
@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --experimental-wasm-multi-memory --experimental-wasm-memory64
+// Flags: --no-liftoff
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Accesses with zero-extended i32 indexes or constant indexes are covered by
+// the guard regions of a memory64 without a (small) maximum, so they do not
+// need an explicit check. Make sure they still trap when out of bounds, also
+// for memories with small guard regions and for secondary memories.
+(function TestZeroExtendedIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const kNoMaximum = builder.addMemory64(1);
+  const kSmallMaximum = builder.addMemory64(1, 1);
+  builder.exportMemoryAs('mem0', kNoMaximum);
+  builder.exportMemoryAs('mem1', kSmallMaximum);
+  for (const mem of [kNoMaximum, kSmallMaximum]) {
+    builder.addFunction('load' + mem, kSig_i_i)
+        .addBody([
+          kExprLocalGet, 0, kExprI64UConvertI32,
+          kExprI32LoadMem, 0x42, mem, 0
+        ])
+        .exportFunc();
+    builder.addFunction('loadConst' + mem, kSig_i_v)
+        .addBody([
+          ...wasmI64Const(0x1_0000_0000), kExprI32LoadMem, 0x42, mem, 0
+        ])
+        .exportFunc();
+    builder.addFunction('store' + mem, kSig_v_ii)
+        .addBody([
+          kExprLocalGet, 0, kExprI64UConvertI32, kExprLocalGet, 1,
+          kExprI32StoreMem, 0x42, mem, 0
+        ])
+        .exportFunc();
+  }
+  const instance = builder.instantiate();
+  for (const mem of [kNoMaximum, kSmallMaximum]) {
+    const load = instance.exports['load' + mem];
+    const store = instance.exports['store' + mem];
+    const view = new DataView(instance.exports['mem' + mem].buffer);
+    store(16, 42 + mem);
+    assertEquals(42 + mem, view.getInt32(16, true));
+    assertEquals(42 + mem, load(16));
+    assertEquals(0, load(kPageSize - 4));
+    for (const index of [kPageSize - 3, kPageSize, 0x7fffffff, -1]) {
+      assertTraps(kTrapMemOutOfBounds, () => load(index));
+      assertTraps(kTrapMemOutOfBounds, () => store(index, 1));
+    }
+    assertTraps(kTrapMemOutOfBounds, instance.exports['loadConst' + mem]);
+  }
+})();
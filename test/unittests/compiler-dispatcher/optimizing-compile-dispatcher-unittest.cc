@@ -96,5 +96,39 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, QueuePrioritizesByCost) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  std::unique_ptr<BlockingCompilationJob> expensive(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> cheap(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> medium(
+      new BlockingCompilationJob(i_isolate(), fun));
+
+  OptimizingCompileDispatcherQueue fifo_queue(4);
+  fifo_queue.Enqueue(expensive.get(), 1000);
+  fifo_queue.Enqueue(cheap.get(), 10);
+  fifo_queue.Enqueue(medium.get(), 100);
+  EXPECT_EQ(expensive.get(), fifo_queue.Dequeue());
+  EXPECT_EQ(cheap.get(), fifo_queue.Dequeue());
+  EXPECT_EQ(medium.get(), fifo_queue.Dequeue());
+  EXPECT_EQ(nullptr, fifo_queue.Dequeue());
+
+  OptimizingCompileDispatcherQueue priority_queue(4, true);
+  priority_queue.Enqueue(expensive.get(), 1000);
+  priority_queue.Enqueue(cheap.get(), 10);
+  priority_queue.Enqueue(medium.get(), 100);
+  base::TimeDelta wait_time;
+  EXPECT_EQ(cheap.get(), priority_queue.Dequeue(&wait_time));
+  EXPECT_LE(base::TimeDelta(), wait_time);
+  EXPECT_EQ(medium.get(), priority_queue.Dequeue());
+  EXPECT_EQ(expensive.get(), priority_queue.Dequeue());
+  EXPECT_EQ(nullptr, priority_queue.Dequeue());
+}
+
 }  // namespace internal
 }  // namespace v8
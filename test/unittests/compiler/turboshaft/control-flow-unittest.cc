@@ -7,6 +7,7 @@
 #include "src/compiler/turboshaft/branch-elimination-reducer.h"
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/dead-code-elimination-reducer.h"
+#include "src/compiler/turboshaft/instruction-selection-phase.h"
 #include "src/compiler/turboshaft/loop-peeling-reducer.h"
 #include "src/compiler/turboshaft/machine-optimization-reducer.h"
 #include "src/compiler/turboshaft/operations.h"
@@ -14,6 +15,7 @@
 #include "src/compiler/turboshaft/required-optimization-reducer.h"
 #include "src/compiler/turboshaft/simplified-lowering-reducer.h"
 #include "src/compiler/turboshaft/variable-reducer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/turboshaft/reducer-test.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -197,6 +199,39 @@ TEST_F(ControlFlowTest, LoopVar) {
   ASSERT_EQ(0u, test.CountOp(Opcode::kPendingLoopPhi));
 }
 
+// With --turbo-profile-guided-block-layout, the successor that the branch hint
+// marks as likely should directly follow the branching block in the special
+// RPO, so that it becomes the fall-through block.
+TEST_F(ControlFlowTest, ProfileGuidedBlockLayout) {
+  FlagScope<bool> layout_scope(&v8_flags.turbo_profile_guided_block_layout,
+                               true);
+  Block* if_true = nullptr;
+  Block* if_false = nullptr;
+  auto test = CreateFromGraph(1, [&](auto& Asm) {
+    V<Word32> cond =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::FromInt(0)));
+    if_true = __ NewBlock();
+    if_false = __ NewBlock();
+    Block* merge = __ NewBlock();
+    __ Branch(cond, if_true, if_false, BranchHint::kTrue);
+
+    __ Bind(if_false);
+    __ Goto(merge);
+
+    __ Bind(if_true);
+    __ Goto(merge);
+
+    __ Bind(merge);
+    __ Return(cond);
+  });
+
+  TurboshaftSpecialRPONumberer numberer(test.graph(), zone());
+  ZoneVector<uint32_t> order = numberer.ComputeSpecialRPO();
+  ASSERT_EQ(4u, order.size());
+  EXPECT_EQ(if_true->index().id(), order[1]);
+  EXPECT_EQ(if_false->index().id(), order[2]);
+}
+
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
 
 }  // namespace v8::internal::compiler::turboshaft
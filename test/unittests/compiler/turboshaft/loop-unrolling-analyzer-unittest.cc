@@ -4,6 +4,7 @@
 
 #include "src/compiler/turboshaft/assembler.h"
 #include "src/compiler/turboshaft/loop-unrolling-reducer.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/turboshaft/reducer-test.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -416,6 +417,101 @@ INSTANTIATE_TEST_SUITE_P(LoopUnrollingAnalyzerTest,
                          LoopUnrollingAnalyzerOverflowTest,
                          ::testing::ValuesIn(kUnderOverflowBoundedLoops));
 
+class TypedArrayKernelLoopTest : public LoopUnrollingAnalyzerTest {
+ protected:
+  // Builds a loop with an unknown iteration count that loads from its first
+  // parameter with {load_kind} and adds {filler_count} extra Word32Add to the
+  // loaded value.
+  TestInstance CreateLoadLoop(LoadOp::Kind load_kind, int filler_count) {
+    return CreateFromGraph(1, [=](auto& Asm) {
+      using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+      OpIndex base = Asm.GetParameter(0);
+      V<Word32> bound = V<Word32>::Cast(
+          __ Load(base, load_kind, MemoryRepresentation::Int32()));
+
+      ScopedVariable<Word32, AssemblerT> index(&Asm, 0);
+      ScopedVariable<Word32, AssemblerT> sum(&Asm, 0);
+
+      WHILE(__ Int32LessThan(index, bound)) {
+        V<Word32> value = V<Word32>::Cast(
+            __ Load(base, load_kind, MemoryRepresentation::Int32(), 16));
+        for (int i = 0; i < filler_count; i++) {
+          value = __ Word32Add(value, index);
+        }
+        sum = __ Word32Add(sum, value);
+        index = __ Word32Add(index, 1);
+      }
+
+      __ Return(sum);
+    });
+  }
+
+  size_t LoopSize(TestInstance& test) {
+    LoopFinder loop_finder(test.zone(), &test.graph());
+    return loop_finder.GetLoopInfo(&GetFirstLoop(test.graph())).op_count;
+  }
+
+  // Returns a number of filler operations for which the loop is too large to
+  // be partially unrolled as a regular JS loop, but small enough to be
+  // partially unrolled as a TypedArray kernel.
+  int MediumLoopFillerCount(LoadOp::Kind load_kind) {
+    auto empty = CreateLoadLoop(load_kind, 0);
+    auto one = CreateLoadLoop(load_kind, 1);
+    size_t empty_size = LoopSize(empty);
+    size_t filler_size = LoopSize(one) - empty_size;
+    constexpr size_t kTargetSize =
+        (LoopUnrollingAnalyzer::kJSMaxLoopSizeForPartialUnrolling +
+         LoopUnrollingAnalyzer::
+             kTypedArrayKernelMaxLoopSizeForPartialUnrolling) /
+        2;
+    return static_cast<int>((kTargetSize - empty_size) / filler_size);
+  }
+};
+
+// Checking that JS loops whose size is between the JS and the TypedArray
+// kernel partial unrolling limits are only partially unrolled when
+// --turboshaft-typed-array-loop-unrolling is enabled, and only if they access
+// ArrayBuffer backing stores.
+TEST_F(TypedArrayKernelLoopTest, MediumLoopUnrolledOnlyWithFlag) {
+  LoadOp::Kind backing_store_load =
+      LoadOp::Kind::TaggedBase().NotLoadEliminable();
+  auto test = CreateLoadLoop(backing_store_load,
+                             MediumLoopFillerCount(backing_store_load));
+  const Block& loop = GetFirstLoop(test.graph());
+  size_t loop_size = LoopSize(test);
+  ASSERT_GE(loop_size,
+            LoopUnrollingAnalyzer::kJSMaxLoopSizeForPartialUnrolling);
+  ASSERT_LT(
+      loop_size,
+      LoopUnrollingAnalyzer::kTypedArrayKernelMaxLoopSizeForPartialUnrolling);
+
+  {
+    FlagScope<bool> typed_array_unrolling(
+        &v8_flags.turboshaft_typed_array_loop_unrolling, false);
+    LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+    EXPECT_FALSE(analyzer.ShouldPartiallyUnrollLoop(&loop));
+  }
+  {
+    FlagScope<bool> typed_array_unrolling(
+        &v8_flags.turboshaft_typed_array_loop_unrolling, true);
+    LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+    EXPECT_TRUE(analyzer.ShouldPartiallyUnrollLoop(&loop));
+  }
+}
+
+TEST_F(TypedArrayKernelLoopTest, MediumLoopWithoutBackingStoreNotUnrolled) {
+  LoadOp::Kind field_load = LoadOp::Kind::TaggedBase();
+  auto test = CreateLoadLoop(field_load, MediumLoopFillerCount(field_load));
+  const Block& loop = GetFirstLoop(test.graph());
+  ASSERT_GE(LoopSize(test),
+            LoopUnrollingAnalyzer::kJSMaxLoopSizeForPartialUnrolling);
+
+  FlagScope<bool> typed_array_unrolling(
+      &v8_flags.turboshaft_typed_array_loop_unrolling, true);
+  LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+  EXPECT_FALSE(analyzer.ShouldPartiallyUnrollLoop(&loop));
+}
+
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
 
 }  // namespace v8::internal::compiler::turboshaft
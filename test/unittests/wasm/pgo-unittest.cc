@@ -0,0 +1,51 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/pgo.h"
+
+#include <cstdio>
+
+#include "src/wasm/wasm-module.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8::internal::wasm {
+
+class WasmPgoTest : public ::testing::Test {};
+
+TEST_F(WasmPgoTest, ConsumedBudgetsAreClamped) {
+  FLAG_VALUE_SCOPE(wasm_tiering_budget, 1000);
+
+  WasmModule module;
+  module.num_declared_functions = 4;
+  // Not executed, partially consumed, above the initial budget (e.g. after the
+  // flag changed), and decremented below zero by generated code.
+  std::atomic<uint32_t> budgets[] = {1000, 990, 1005,
+                                     static_cast<uint32_t>(-7)};
+  // The bytes are only used to derive the profile file name.
+  const uint8_t wire_bytes[] = {0x00, 0x61, 0x73, 0x6d, 0x70, 0x67, 0x6f, 0x01};
+  base::Vector<const uint8_t> wire_bytes_vec = base::ArrayVector(wire_bytes);
+
+  DumpProfileToFile(&module, wire_bytes_vec, budgets);
+  std::unique_ptr<ProfileInformation> profile =
+      LoadProfileFromFile(&module, wire_bytes_vec);
+
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "profile-wasm-%08x",
+           static_cast<uint32_t>(GetWireBytesHash(wire_bytes_vec)));
+  std::remove(filename.begin());
+
+  ASSERT_NE(nullptr, profile);
+  ASSERT_EQ(4u, profile->consumed_budgets().size());
+  EXPECT_EQ(0u, profile->consumed_budgets()[0]);
+  EXPECT_EQ(10u, profile->consumed_budgets()[1]);
+  EXPECT_EQ(0u, profile->consumed_budgets()[2]);
+  EXPECT_EQ(1000u, profile->consumed_budgets()[3]);
+
+  // Functions with a changed budget are still reported as executed.
+  EXPECT_EQ(3u, profile->executed_functions().size());
+  EXPECT_TRUE(profile->tiered_up_functions().empty());
+}
+
+}  // namespace v8::internal::wasm